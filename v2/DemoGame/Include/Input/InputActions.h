@@ -19,5 +19,9 @@ enum InputActions : int
 	ACTION_INTERACT,	
 
 	// UI
-	PAUSE_ACTION
+	PAUSE_ACTION,
+	RESTART_ACTION,
+
+	// Debug
+	DEBUG_WALK_TO_EXIT
 };
@@ -8,6 +8,7 @@
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Actor.h"
 #include "Component/CollisionComponent.h"
+#include "Framework/World/EventBus.h"
 #include "Utility/Delegate.h"
 
 namespace we
@@ -25,9 +26,10 @@ namespace we
 		void EndPlay() override;
 
 	private:
-		void OnBeginOverlap(Actor* Other);
+		void OnOverlap(const OverlapEvent& Event);
 
 	private:
 		shared<CollisionComponent> CollComp;
+		EventListener OverlapListener;
 	};
 }
\ No newline at end of file
@@ -39,6 +39,9 @@ namespace we
 		// Utility
 		bool IsQuestComplete() const { return State.bCanExitForest; }
 
+		// Checkpoints rewind progress along with the player
+		void SetState(const FQuestState& InState) { State = InState; }
+
 	private:
 		FQuestState State;
 	};
@@ -7,6 +7,8 @@
 
 #include "Core/CoreMinimal.h"
 #include "Framework/World/World.h"
+#include "Framework/World/LevelLoader.h"
+#include "Navigation/FlowField.h"
 #include "Subsystem/InputSubsystem.h"
 #include "UI/TutorialUI.h"
 
@@ -17,7 +19,6 @@ namespace we
     class CollisionActor;
     class PauseMenuUI;
     class PostProcessingComponent;
-    class LevelObject;
     class TutorialUI;
 
     class LevelOne : public World
@@ -41,39 +42,27 @@ namespace we
         void OnTutorialContinue();
         void SpawnCharacter();
         void ShowTutorialDelayed();
+        void RestartFromCheckpoint();
+        void ToggleWalkToExit();
 
     private:
-        shared<texture> BG;
+        LevelLoader Level;
         shared<texture> Water;
-        shared<Actor> BGImage;
         shared<Actor> WaterImage;
-        shared<texture> Hut1Tex;
-        shared<texture> Hut1TexShadow;
-        shared<Actor> Hut1;
-        shared<Actor> Hut1Shadow;
-        shared<texture> Hut2Tex;
-        shared<texture> Hut2TexShadow;
-        shared<Actor> Hut2;
-        shared<Actor> Hut2Shadow;
-        shared<texture> Hut3Tex;
-        shared<texture> Hut3TexShadow;
-        shared<Actor> Hut3;
-        shared<Actor> Hut3Shadow;
         shared<PostProcessingComponent> WaterPPC;
         shared<PlayerCharacter> Character;
         unique<PauseMenuUI> PauseUI;
         unique<TutorialUI> TutorialUI;
         bool bTutorialActive = false;
-        
-        unique<LevelObject> Tree1;
-        unique<LevelObject> Tree2;
-        unique<LevelObject> Tree3;
-        unique<LevelObject> Tree4;
-        unique<LevelObject> Tree5;
-        unique<LevelObject> Tree6;
-        unique<LevelObject> Tree7;
-        unique<LevelObject> Tree8;
 
         BindingHandle PauseBinding;
+        BindingHandle RestartBinding;
+        BindingHandle WalkToExitBinding;
+
+        // Debug builds only: the player can be sent along a flow field to the forest exit
+        FlowFieldID ExitFlow = INVALID_FLOW_FIELD;
+
+        // Captured once the player spawns; quick restart rewinds to it without reloading the level
+        WorldSnapshot Checkpoint;
     };
 }
\ No newline at end of file
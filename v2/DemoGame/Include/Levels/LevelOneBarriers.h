@@ -1,15 +0,0 @@
-// =============================================================================
-// Water Engine v2.1.2 - Demo Game
-// Copyright(C) 2026 Will The Water
-// =============================================================================
-
-#pragma once
-
-#include "Core/CoreMinimal.h"
-
-namespace we
-{
-    class World;
-
-    void CreateLevelOneBarriers(World& InWorld);
-}
\ No newline at end of file
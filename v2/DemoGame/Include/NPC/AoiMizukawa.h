@@ -49,6 +49,8 @@ namespace we
 		void Tick(float DeltaTime) override;
 		void EndPlay() override;
 		void GetDrawables(vector<const drawable*>& OutDrawables) const override;
+		void SaveState(SnapshotWriter& Out) const override;
+		void LoadState(SnapshotReader& In) override;
 
 	private:
 		void SetupAnimation();
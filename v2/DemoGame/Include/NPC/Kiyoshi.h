@@ -7,7 +7,8 @@
 
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Character.h"
-#include "Subsystem/TimerSubsystem.h"
+#include "Framework/World/TaskScheduler.h"
+#include "Subsystem/NavigationSubsystem.h"
 #include "Interaction/IInteractable.h"
 #include "UI/InteractUI.h"
 #include "UI/DialogUI.h"
@@ -69,6 +70,8 @@ namespace we
 		void Tick(float DeltaTime) override;
 		void EndPlay() override;
 		void GetDrawables(vector<const drawable*>& OutDrawables) const override;
+		void SaveState(SnapshotWriter& Out) const override;
+		void LoadState(SnapshotReader& In) override;
 
 	private:
 		void SetupAnimations();
@@ -76,9 +79,11 @@ namespace we
 		EKiyoshiState DirectionToIdleAnim(const vec2f& Dir) const;
 		EKiyoshiState DirectionToWalkAnim(const vec2f& Dir) const;
 		
+		GameTask Patrol();
+		GameTask ResumeAfterTalking();
 		void StartMovingToNextWaypoint();
-		void OnWaitComplete();
-		void OnResumeFromInteraction();
+		void RequestPathToWaypoint();
+		void OnPathFound(const NavPath& Path);
 		void FacePlayer();
 		void SetupShadow();
 		void StartDialog(class PlayerCharacter* Player);
@@ -90,7 +95,15 @@ namespace we
 		vector<vec2f> Waypoints;
 		size_t CurrentWaypointIndex = 0;
 		EAIState AIState = EAIState::Waiting;
-		TimerHandle WaitTimer;
+		EAIState StateBeforeTalking = EAIState::Waiting;
+		TaskHandle PatrolTask;
+		TaskHandle ResumeTask;
+
+		// Route to the current waypoint around static collision, in actor positions
+		vector<vec2f> PathPoints;
+		size_t PathIndex = 0;
+		NavRequestID PathRequest = INVALID_NAV_REQUEST;
+
 		Actor* CurrentInteractor = nullptr;
 		InteractUI PromptUI;
 		DialogUI DialogBox;
@@ -7,12 +7,15 @@
 
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Character.h"
+#include "Framework/World/EventBus.h"
 #include "Subsystem/InputSubsystem.h"
 #include "Interaction/IInteractable.h"
 #include "Interaction/QuestComponent.h"
 
 namespace we
 {
+	struct OverlapEvent;
+
 	enum class EPlayerAnim : uint8
 	{
 		// Idle animations
@@ -53,6 +56,8 @@ namespace we
 		void Tick(float DeltaTime) override;
 		void EndPlay() override;
 		void GetDrawables(vector<const drawable*>& OutDrawables) const override;
+		void SaveState(SnapshotWriter& Out) const override;
+		void LoadState(SnapshotReader& In) override;
 
 	private:
 		void SetupAnimations();
@@ -61,9 +66,10 @@ namespace we
 		void PollInteractButton();
 		void UpdateDirectionalAnimation();
 		void TryInteract();
+		void OnOverlap(const OverlapEvent& Event);
 		void OnBeginOverlap(Actor* Other);
 		void OnEndOverlap(Actor* Other);
-		void StartInteraction(IInteractable* Target);
+		void StartInteraction(Actor* TargetActor, IInteractable* Target);
 		void EndInteraction();
 		EPlayerAnim DirectionToIdleAnim(const vec2f& Dir) const;
 		EPlayerAnim DirectionToWalkAnim(const vec2f& Dir) const;
@@ -72,6 +78,7 @@ namespace we
 		void FaceInteractionTarget(Actor* Target);
 
 		BindingHandle InteractBinding;
+		EventListener OverlapListener;
 		
 		// Interaction state
 		IInteractable* CurrentInteractable = nullptr;
@@ -14,6 +14,8 @@ namespace we
 	Compass::Compass(World& OwningWorld)
 		: Actor(OwningWorld)
 	{
+		// Picked up after the checkpoint, it is put back when the player restarts
+		SetSnapshotEnabled(true);
 	}
 
 	Compass::~Compass() = default;
@@ -80,7 +82,7 @@ namespace we
 
 	void Compass::Interact(Actor* Interactor)
 	{
-		auto* Player = dynamic_cast<PlayerCharacter*>(Interactor);
+		auto* Player = Interactor ? Interactor->Cast<PlayerCharacter>() : nullptr;
 		if (!Player) return;
 
 		// Mark quest item found
@@ -5,6 +5,7 @@
 
 #include "Interaction/ForestExit.h"
 #include "Player/PlayerCharacter.h"
+#include "Framework/World/World.h"
 
 namespace we
 {
@@ -23,18 +24,24 @@ namespace we
 		CollComp = make_shared<CollisionComponent>(this);
 		CollComp->SetRadius(100.0f);
 		CollComp->SetCollisionChannel(ECollisionChannel::Interaction);
-		CollComp->OnBeginOverlap.Bind(this, &ForestExit::OnBeginOverlap);
 		CollComp->BeginPlay();
+
+		// Leaving loads another world, which must not happen in the middle of the physics step
+		OverlapListener = GetWorld().GetEvents().Subscribe(weak_from_this(), &ForestExit::OnOverlap, GetID());
 	}
 
 	void ForestExit::EndPlay()
 	{
+		GetWorld().GetEvents().Unsubscribe(OverlapListener);
 		Actor::EndPlay();
 	}
 
-	void ForestExit::OnBeginOverlap(Actor* Other)
+	void ForestExit::OnOverlap(const OverlapEvent& Event)
 	{
-		auto* Player = dynamic_cast<PlayerCharacter*>(Other);
+		if (!Event.bBegin) return;
+
+		Actor* Other = GetWorld().FindActor(Event.Other);
+		auto* Player = Other ? Other->Cast<PlayerCharacter>() : nullptr;
 		if (!Player) return;
 
 		// Only allow exit if quest is complete
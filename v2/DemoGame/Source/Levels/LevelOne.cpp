@@ -6,13 +6,12 @@
 #include "Levels/LevelOne.h"
 #include "Levels/MainMenu.h"
 #include "Levels/Credits.h"
-#include "Levels/LevelOneBarriers.h"
-#include "Level/LevelObject.h"
 #include "Framework/World/Actor.h"
 #include "Framework/World/Character.h"
 #include "Player/PlayerCharacter.h"
 #include "Component/CameraComponent.h"
 #include "Component/PhysicsComponent.h"
+#include "Component/MovementComponent.h"
 #include "UI/PauseMenuUI.h"
 #include "Subsystem/TimerSubsystem.h"
 #include "Subsystem/ResourceSubsystem.h"
@@ -21,7 +20,6 @@
 #include "Subsystem/SaveSubsystem.h"
 #include "Subsystem/CursorSubsystem.h"
 #include "Component/PostProcessingComponent.h"
-#include "Framework/World/Barrier.h"
 #include "NPC/AoiMizukawa.h"
 #include "NPC/Kiyoshi.h"
 #include "Interaction/Compass.h"
@@ -42,11 +40,6 @@ namespace we
 
     void LevelOne::BeginPlay()
     {
-        BG = LoadAsset().LoadTexture("Assets/Textures/Game/world.png");
-        BGImage = SpawnActor<Actor>().lock();
-        BGImage->SetSprite(BG);
-        BGImage->SetCustomRenderDepth(-20.f);
-
         Water = LoadAsset().LoadTexture("Assets/Textures/Game/water.png");
         WaterImage = SpawnActor<Actor>().lock();
         WaterImage->SetPosition({ 0, 2900 });
@@ -61,173 +54,37 @@ namespace we
         TimesPlayed++;
         Subsystem.GetSave().Set(SAVE_TIMES_PLAYED, TimesPlayed);
         Subsystem.GetSave().Set(SAVE_LAST_LEVEL, "LevelOne");
-        
-        auto Aoi = SpawnActor<AoiMizukawa>().lock();
-        Aoi->SetPosition({ 4700, 2400 });
-
-        auto Kiyo = SpawnActor<Kiyoshi>().lock();
-        Kiyo->SetPosition({1280, 1020});
-        Kiyo->SetWaypoints({
-            {1280, 1020}, 
-            {1626, 1175}, 
-            {2630, 1360}, 
-            {4200, 1180}, 
-            {5381, 1111}, 
-            {4770, 1681}, 
-            {1352, 1750}
+
+        // Props, barriers, NPCs and spawn points come from the level file; props stream around the camera
+        Level.RegisterActorType<AoiMizukawa>("AoiMizukawa");
+        Level.RegisterActorType<Compass>("Compass");
+        Level.RegisterActorType<ForestExit>("ForestExit");
+        Level.RegisterActorType("Kiyoshi", [](World& InWorld, const LevelActorSpawn& Spawn) -> shared<Actor>
+        {
+            auto Kiyo = InWorld.SpawnActor<Kiyoshi>().lock();
+            Kiyo->SetPosition(Spawn.Position);
+            Kiyo->SetWaypoints(Spawn.Waypoints);
+            return Kiyo;
         });
+        Level.LoadStreamed(*this, "Assets/Levels/LevelOne.welv");
 
-        // Quest item
-        auto CompassItem = SpawnActor<Compass>().lock();
-        CompassItem->SetPosition({ 5281, 544 });
-
-        // Forest exit
-        auto Exit = SpawnActor<ForestExit>().lock();
-        Exit->SetPosition({ 3050.0f, 20.0f });
-        Exit->OnExitTriggered.Bind(this, &LevelOne::OnExitGame);
-
-        // Create all level barriers
-        CreateLevelOneBarriers(*this);
-
-        // Hut 1
-        Hut1 = SpawnActor<Actor>().lock();
-        Hut1Shadow = SpawnActor<Actor>().lock();
-        Hut1Tex = LoadAsset().LoadTexture("Assets/Textures/Game/hut1.png");
-        Hut1TexShadow = LoadAsset().LoadTexture("Assets/Textures/Game/hut1shadow.png");
-        Hut1->SetSprite(Hut1Tex);
-        Hut1Shadow->SetSprite(Hut1TexShadow);
-        Hut1->SetSpriteOrigin({ 545, 747 });
-        Hut1Shadow->SetSpriteOrigin({ 545, 747 });
-        Hut1->SetPosition({777, 927});
-        Hut1Shadow->SetPosition({777, 927});
-        Hut1Shadow->SetCustomRenderDepth(10000.f);
-
-        // Hut 2
-        Hut2 = SpawnActor<Actor>().lock();
-        Hut2Shadow = SpawnActor<Actor>().lock();
-        Hut2Tex = LoadAsset().LoadTexture("Assets/Textures/Game/hut2.png");
-        Hut2TexShadow = LoadAsset().LoadTexture("Assets/Textures/Game/hut2shadow.png");
-        Hut2->SetSprite(Hut2Tex);
-        Hut2Shadow->SetSprite(Hut2TexShadow);
-        Hut2->SetSpriteOrigin({ 556, 674 });
-        Hut2Shadow->SetSpriteOrigin({ 556, 674 });
-        Hut2->SetPosition({ 2097, 707 });
-        Hut2Shadow->SetPosition({ 2097, 707 });
-        Hut2Shadow->SetCustomRenderDepth(10000.f);
-
-        // Hut 3
-        Hut3 = SpawnActor<Actor>().lock();
-        Hut3Shadow = SpawnActor<Actor>().lock();
-        Hut3Tex = LoadAsset().LoadTexture("Assets/Textures/Game/hut3.png");
-        Hut3TexShadow = LoadAsset().LoadTexture("Assets/Textures/Game/hut3shadow.png");
-        Hut3->SetSprite(Hut3Tex);
-        Hut3Shadow->SetSprite(Hut3TexShadow);
-        Hut3->SetSpriteOrigin({ 414, 606 });
-        Hut3Shadow->SetSpriteOrigin({ 414, 606 });
-        Hut3->SetPosition({ 3800, 606 });
-        Hut3Shadow->SetPosition({ 3800, 606 });
-        Hut3Shadow->SetCustomRenderDepth(10000.f);
-
-        // Tree 1
-        Tree1 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/tree1.png",
-            "Assets/Textures/Game/tree1Shadow.png",
-            vec2f{5358, 778},
-            vec2f{384, 885},
-            80.f,
-            vec2f{0, 70}
-        );
-        Tree1->Init();
-
-        // Tree 2
-        Tree2 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/tree2.png",
-            "Assets/Textures/Game/tree2Shadow.png",
-            vec2f{ 2500, 1024 },
-            vec2f{ 330, 580 },
-            46.f,
-            vec2f{ 10, 50 }
-        );
-        Tree2->Init();
-
-        // Tree 3
-        Tree3 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/tree3.png",
-            "Assets/Textures/Game/tree3Shadow.png",
-            vec2f{ 1398, 427 },
-            vec2f{ 612, 903 },
-            80.f,
-            vec2f{ 0, 70 }
-        );
-        Tree3->Init();
-
-        // Tree 4
-        Tree4 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/tree4.png",
-            "Assets/Textures/Game/tree4Shadow.png",
-            vec2f{ 2496, 357 },
-            vec2f{ 523, 813 },
-            80.f,
-            vec2f{ 0, 70 }
-        );
-        Tree4->Init();
-
-        // Tree 5
-        Tree5 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/palm1.png",
-            "Assets/Textures/Game/palm1Shadow.png",
-            vec2f{ 386, 1959 },
-            vec2f{ 385, 803 },
-            35.f,
-            vec2f{ 0, 60 }
-        );
-        Tree5->Init();
-
-        // Tree 6
-        Tree6 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/palm1.png",
-            "Assets/Textures/Game/palm1Shadow.png",
-            vec2f{ 3907, 1407 },
-            vec2f{ 385, 803 },
-            35.f,
-            vec2f{ 0, 60 }
-        );
-        Tree6->Init();
-
-        // Tree 7
-        Tree7 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/palm2.png",
-            "Assets/Textures/Game/palm2Shadow.png",
-            vec2f{ 5178, 2000 },
-            vec2f{ 556, 900 },
-            58.f,
-            vec2f{ -10, 60 }
-        );
-        Tree7->Init();
-
-        // Tree 8
-        Tree8 = we::make_unique<LevelObject>(
-            *this,
-            "Assets/Textures/Game/palm2.png",
-            "Assets/Textures/Game/palm2Shadow.png",
-            vec2f{ 1966, 1490 },
-            vec2f{ 556, 900 },
-            58.f,
-            vec2f{ -10, 60 }
-        );
-        Tree8->Init();
+        if (auto Exit = std::dynamic_pointer_cast<ForestExit>(Level.FindActor("ForestExit")))
+        {
+            Exit->OnExitTriggered.Bind(this, &LevelOne::OnExitGame);
+        }
 
         InputController().Bind(PAUSE_ACTION, Input::Keyboard{ sf::Keyboard::Scan::Escape });
         InputController().Bind(PAUSE_ACTION, Input::Gamepad{ GamepadButton::Start, 0 });
         PauseBinding = InputController().BindAction(PAUSE_ACTION, this, &LevelOne::TogglePauseMenu);
 
+        InputController().Bind(RESTART_ACTION, Input::Keyboard{ sf::Keyboard::Scan::F5 });
+        RestartBinding = InputController().BindAction(RESTART_ACTION, this, &LevelOne::RestartFromCheckpoint);
+
+#ifdef WE_DEBUG
+        InputController().Bind(DEBUG_WALK_TO_EXIT, Input::Keyboard{ sf::Keyboard::Scan::F6 });
+        WalkToExitBinding = InputController().BindAction(DEBUG_WALK_TO_EXIT, this, &LevelOne::ToggleWalkToExit);
+#endif
+
         PauseUI = make_unique<PauseMenuUI>();
         PauseUI->Initialize(Subsystem.GetSave());
 
@@ -292,6 +149,9 @@ namespace we
             WaterPPC->EndPlay();
             WaterPPC.reset();
         }
+
+        GetNavigation().DestroyFlowField(ExitFlow);
+        ExitFlow = INVALID_FLOW_FIELD;
     }
 
     void LevelOne::OnTutorialContinue()
@@ -323,11 +183,53 @@ namespace we
 
     void LevelOne::SpawnCharacter()
     {
-        float PlayerX = Subsystem.GetSave().Get<float>(SAVE_PLAYER_POS_X, 5510.f);
-        float PlayerY = Subsystem.GetSave().Get<float>(SAVE_PLAYER_POS_Y, 2600.f);
+        const vec2f Start = Level.FindSpawnPoint("Player").value_or(vec2f{ 5510.f, 2600.f });
+        float PlayerX = Subsystem.GetSave().Get<float>(SAVE_PLAYER_POS_X, Start.x);
+        float PlayerY = Subsystem.GetSave().Get<float>(SAVE_PLAYER_POS_Y, Start.y);
         
         Character = SpawnActor<PlayerCharacter>().lock();
         Character->SetPosition({PlayerX, PlayerY});
+
+        Checkpoint = CaptureSnapshot();
+    }
+
+    void LevelOne::RestartFromCheckpoint()
+    {
+        if (bTutorialActive || Checkpoint.IsEmpty())
+            return;
+
+        if (PauseUI && PauseUI->IsVisible())
+        {
+            ResumeGame();
+        }
+        RestoreSnapshot(Checkpoint);
+    }
+
+    void LevelOne::ToggleWalkToExit()
+    {
+        if (!Character)
+            return;
+
+        auto MoveComp = Character->GetMovementComponent();
+        if (MoveComp->IsFollowingFlowField())
+        {
+            MoveComp->StopFollowingFlowField();
+            return;
+        }
+
+        if (ExitFlow == INVALID_FLOW_FIELD)
+        {
+            auto Exit = Level.FindActor("ForestExit");
+            if (!Exit)
+            {
+                WARNING("[LevelOne] No forest exit to walk to");
+                return;
+            }
+            ExitFlow = GetNavigation().CreateFlowField(Exit->GetPosition());
+        }
+
+        // The grid is built for the feet, not the sprite center
+        MoveComp->FollowFlowField(ExitFlow, Character->GetPhysicsComponent()->GetShapeOffset());
     }
 
     void LevelOne::TogglePauseMenu()
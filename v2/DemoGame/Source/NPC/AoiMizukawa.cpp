@@ -9,6 +9,7 @@
 #include "Component/CollisionComponent.h"
 #include "Subsystem/ResourceSubsystem.h"
 #include "Player/PlayerCharacter.h"
+#include "Framework/World/WorldSnapshot.h"
 #include "Utility/Log.h"
 #include "Utility/Math.h"
 
@@ -18,13 +19,14 @@ namespace we
 	AoiMizukawa::AoiMizukawa(World& OwningWorld)
 		: Character(OwningWorld)
 	{
+		SetSnapshotEnabled(true);
 	}
 
 	AoiMizukawa::~AoiMizukawa() = default;
 
 	void AoiMizukawa::Interact(Actor* Interactor)
 	{
-		auto* Player = dynamic_cast<PlayerCharacter*>(Interactor);
+		auto* Player = Interactor ? Interactor->Cast<PlayerCharacter>() : nullptr;
 		if (!Player) return;
 
 		if (!bInDialog)
@@ -257,6 +259,33 @@ namespace we
 		Character::GetDrawables(OutDrawables);
 	}
 
+	void AoiMizukawa::SaveState(SnapshotWriter& Out) const
+	{
+		Character::SaveState(Out);
+
+		// Where she looks when nobody is talking to her
+		Out.Write(CurrentInteractor ? OriginalFacingDirection : FacingDirection);
+	}
+
+	void AoiMizukawa::LoadState(SnapshotReader& In)
+	{
+		Character::LoadState(In);
+
+		In.Read(FacingDirection);
+		OriginalFacingDirection = FacingDirection;
+
+		if (!HasBegunPlay())
+			return;
+
+		// The dialog follows quest progress, which rewinds with the player
+		CurrentInteractor = nullptr;
+		PromptUI.Hide();
+		if (bInDialog)
+		{
+			EndDialog();
+		}
+	}
+
 	void AoiMizukawa::SetupShadow()
 	{
 		ShadowTexture = LoadAsset().LoadTexture("Assets/Textures/Game/shadow.png");
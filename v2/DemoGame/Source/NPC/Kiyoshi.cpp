@@ -9,6 +9,9 @@
 #include "Component/CollisionComponent.h"
 #include "Component/MovementComponent.h"
 #include "Subsystem/ResourceSubsystem.h"
+#include "Framework/World/World.h"
+#include "Framework/World/WorldSnapshot.h"
+#include "Core/EngineConfig.h"
 #include "Utility/Math.h"
 #include "Player/PlayerCharacter.h"
 
@@ -17,6 +20,8 @@ namespace we
 	Kiyoshi::Kiyoshi(World& OwningWorld)
 		: Character(OwningWorld)
 	{
+		// Restarting from a checkpoint puts him back on the same leg of his patrol
+		SetSnapshotEnabled(true);
 	}
 
 	Kiyoshi::~Kiyoshi() = default;
@@ -24,11 +29,16 @@ namespace we
 	void Kiyoshi::SetWaypoints(const vector<vec2f>& InWaypoints)
 	{
 		Waypoints = InWaypoints;
+		CurrentWaypointIndex = 0;
+		if (!Waypoints.empty())
+		{
+			SetPosition(Waypoints[0]);
+		}
 	}
 
 	void Kiyoshi::Interact(Actor* Interactor)
 	{
-		auto* Player = dynamic_cast<PlayerCharacter*>(Interactor);
+		auto* Player = Interactor ? Interactor->Cast<PlayerCharacter>() : nullptr;
 		if (!Player) return;
 
 		if (!bInDialog)
@@ -56,6 +66,7 @@ namespace we
 		CollComp->SetCollisionChannel(ECollisionChannel::Interaction);
 
 		MoveComp->SetSpeed(120);
+		MoveComp->EnableAvoidance(42.0f, { 0, 60 });
 
 		Character::BeginPlay();
 
@@ -68,14 +79,41 @@ namespace we
 		DialogBox.Initialize();
 		DialogBox.SetPosition(GetPosition(), { 0.f, -200.f });
 		
-		if (!Waypoints.empty())
+		if (Waypoints.size() >= 2)
 		{
-			CurrentWaypointIndex = 0;
-			SetPosition(Waypoints[0]);
-			StartMovingToNextWaypoint();
+			PatrolTask = GetWorld().GetTasks().Start(weak_from_this(), Patrol());
+		}
+	}
+
+	GameTask Kiyoshi::Patrol()
+	{
+		while (true)
+		{
+			// Tick walks the route and switches to Waiting on arrival. A restored
+			// checkpoint can resume halfway along a leg
+			if (AIState == EAIState::Moving)
+			{
+				RequestPathToWaypoint();
+			}
+			else
+			{
+				StartMovingToNextWaypoint();
+			}
+			co_await WaitUntil([this] { return AIState == EAIState::Waiting; });
+
+			co_await WaitSeconds(RNG().Random(1.0f, 4.0f));
+
+			// Talking pauses the patrol; the next leg starts once the player has left
+			co_await WaitUntil([this] { return AIState != EAIState::Interacting; });
 		}
 	}
 
+	GameTask Kiyoshi::ResumeAfterTalking()
+	{
+		co_await WaitSeconds(RNG().Random(1.0f, 4.0f));
+		AIState = StateBeforeTalking;
+	}
+
 	void Kiyoshi::StartMovingToNextWaypoint()
 	{
 		if (Waypoints.size() < 2)
@@ -83,34 +121,75 @@ namespace we
 		
 		CurrentWaypointIndex = (CurrentWaypointIndex + 1) % Waypoints.size();
 		AIState = EAIState::Moving;
+		RequestPathToWaypoint();
+	}
+
+	void Kiyoshi::RequestPathToWaypoint()
+	{
+		auto& Navigation = GetWorld().GetNavigation();
+		Navigation.CancelPath(PathRequest);
+		PathPoints.clear();
+		PathIndex = 0;
+
+		// The grid is built for the feet, not the sprite center
+		const vec2f Feet = PhysicsComp->GetShapeOffset();
+		PathRequest = Navigation.FindPath(
+			weak_from_this(),
+			GetPosition() + Feet,
+			Waypoints[CurrentWaypointIndex] + Feet,
+			[this](const NavPath& Path) { OnPathFound(Path); }
+		);
+	}
+
+	void Kiyoshi::OnPathFound(const NavPath& Path)
+	{
+		PathRequest = INVALID_NAV_REQUEST;
+		if (!Path.bFound)
+			return;
+
+		const vec2f Feet = PhysicsComp->GetShapeOffset();
+		for (const vec2f& Point : Path.Points)
+		{
+			PathPoints.push_back(Point - Feet);
+		}
+		PathIndex = 0;
 	}
 
 	void Kiyoshi::Tick(float DeltaTime)
 	{
 		if (AIState == EAIState::Moving && !Waypoints.empty())
 		{
-			vec2f TargetPos = Waypoints[CurrentWaypointIndex];
+			// Heads straight for the waypoint until a path arrives, or when none was found
+			const bool bOnPath = PathIndex < PathPoints.size();
+			const bool bFinalPoint = !bOnPath || PathIndex + 1 == PathPoints.size();
+
+			vec2f TargetPos = bOnPath ? PathPoints[PathIndex] : Waypoints[CurrentWaypointIndex];
 			vec2f CurrentPos = GetPosition();
 			vec2f ToTarget = TargetPos - CurrentPos;
 			float DistSq = ToTarget.lengthSquared();
 
-			if (DistSq < 25.0f)
+			// Corners only need to be passed closely, not hit exactly
+			const float CornerRadius = WEConfig.Navigation.CellSize * 0.5f;
+			if (!bFinalPoint && DistSq < CornerRadius * CornerRadius)
+			{
+				++PathIndex;
+			}
+			else if (DistSq < 25.0f)
 			{
 				AIState = EAIState::Waiting;
 				MoveComp->ClearInput();
-
-				float WaitTime = RNG().Random(1.0f, 4.0f);
-				WaitTimer = GetTimer().SetTimer(
-					weak_from_this(),
-					&Kiyoshi::OnWaitComplete,
-					WaitTime,
-					false
-				);
 			}
 			else
 			{
-				vec2f Direction = ToTarget / std::sqrt(DistSq);
-				MoveComp->AddInputVector(Direction);
+				const float Dist = std::sqrt(DistSq);
+				MoveComp->AddInputVector(ToTarget / Dist);
+
+				// Out of view he ticks seldom while his body keeps moving; slow down so the
+				// next check finds him at the waypoint instead of past it
+				if (bFinalPoint)
+				{
+					MoveComp->LimitTravel(Dist);
+				}
 			}
 		}
 
@@ -144,11 +223,12 @@ namespace we
 	{
 		CurrentInteractor = Interactor;
 		
-		GetTimer().ClearTimer(WaitTimer);
-		WaitTimer = TimerHandle();
+		// Back before the resume delay ran out; Kiyoshi is still talking
+		GetWorld().GetTasks().Cancel(ResumeTask);
 		
 		if (AIState != EAIState::Interacting)
 		{
+			StateBeforeTalking = AIState;
 			AIState = EAIState::Interacting;
 			MoveComp->ClearInput();
 			FacePlayer();
@@ -171,30 +251,82 @@ namespace we
 			EndDialog();
 		}
 
-		AIState = EAIState::Waiting;
-		float WaitTime = RNG().Random(1.0f, 4.0f);
-		WaitTimer = GetTimer().SetTimer(
-			weak_from_this(),
-			&Kiyoshi::OnResumeFromInteraction,
-			WaitTime,
-			false
-		);
+		// Lingers a moment before picking up where he left off
+		if (AIState == EAIState::Interacting)
+		{
+			ResumeTask = GetWorld().GetTasks().Start(weak_from_this(), ResumeAfterTalking());
+		}
 	}
 
-	void Kiyoshi::OnWaitComplete()
+	void Kiyoshi::EndPlay()
 	{
-		StartMovingToNextWaypoint();
+		GetWorld().GetTasks().Cancel(PatrolTask);
+		GetWorld().GetTasks().Cancel(ResumeTask);
+		GetWorld().GetNavigation().CancelPath(PathRequest);
+		PathRequest = INVALID_NAV_REQUEST;
+		Character::EndPlay();
 	}
 
-	void Kiyoshi::OnResumeFromInteraction()
+	void Kiyoshi::SaveState(SnapshotWriter& Out) const
 	{
-		AIState = EAIState::Moving;
+		Character::SaveState(Out);
+
+		Out.Write(static_cast<uint>(Waypoints.size()));
+		for (const vec2f& Point : Waypoints)
+		{
+			Out.Write(Point);
+		}
+		Out.Write(CurrentWaypointIndex);
+
+		// Talking is never restored, he goes back to what he was doing before it
+		Out.Write(AIState == EAIState::Interacting ? StateBeforeTalking : AIState);
 	}
 
-	void Kiyoshi::EndPlay()
+	void Kiyoshi::LoadState(SnapshotReader& In)
 	{
-		GetTimer().ClearTimer(WaitTimer);
-		Character::EndPlay();
+		Character::LoadState(In);
+
+		uint WaypointCount = 0;
+		In.Read(WaypointCount);
+		Waypoints.clear();
+		vec2f Point;
+		for (uint i = 0; i < WaypointCount && In.Read(Point); ++i)
+		{
+			Waypoints.push_back(Point);
+		}
+		In.Read(CurrentWaypointIndex);
+		In.Read(AIState);
+
+		if (CurrentWaypointIndex >= Waypoints.size())
+		{
+			CurrentWaypointIndex = 0;
+		}
+		StateBeforeTalking = AIState;
+		PathPoints.clear();
+		PathIndex = 0;
+
+		// A respawned Kiyoshi starts patrolling from this state in BeginPlay
+		if (!HasBegunPlay())
+			return;
+
+		CurrentInteractor = nullptr;
+		PromptUI.Hide();
+		if (bInDialog)
+		{
+			EndDialog();
+		}
+		MoveComp->ClearInput();
+
+		auto& Tasks = GetWorld().GetTasks();
+		Tasks.Cancel(PatrolTask);
+		Tasks.Cancel(ResumeTask);
+		GetWorld().GetNavigation().CancelPath(PathRequest);
+		PathRequest = INVALID_NAV_REQUEST;
+
+		if (Waypoints.size() >= 2)
+		{
+			PatrolTask = Tasks.Start(weak_from_this(), Patrol());
+		}
 	}
 
 	void Kiyoshi::SetupShadow()
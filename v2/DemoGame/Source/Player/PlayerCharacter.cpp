@@ -9,6 +9,8 @@
 #include "Component/CollisionComponent.h"
 #include "Component/MovementComponent.h"
 #include "Component/CameraComponent.h"
+#include "Framework/World/World.h"
+#include "Framework/World/WorldSnapshot.h"
 #include "Interaction/IInteractable.h"
 #include "Input/InputActions.h"
 #include "Input/InputBinding.h"
@@ -25,6 +27,10 @@ namespace we
 	PlayerCharacter::PlayerCharacter(World& OwningWorld)
 		: Character(OwningWorld)
 	{
+		SetSnapshotEnabled(true);
+
+		// The camera follows the player, but input and physics must never be throttled
+		SetAlwaysRelevant(true);
 	}
 
 	PlayerCharacter::~PlayerCharacter() = default;
@@ -39,9 +45,10 @@ namespace we
 
 		CollComp->SetRadius(64.0f);
 		CollComp->SetCollisionChannel(ECollisionChannel::Interaction);
-		CollComp->OnBeginOverlap.Bind(this, &PlayerCharacter::OnBeginOverlap);
-		CollComp->OnEndOverlap.Bind(this, &PlayerCharacter::OnEndOverlap);
 		MoveComp->SetSpeed(240);
+
+		// NPCs step around the player; the player's own input is never deflected
+		MoveComp->EnableAvoidance(38.0f, { 0, 60 }, false);
 		SetScale({ 2.1,2.1 });
 
 		Character::BeginPlay();
@@ -50,6 +57,9 @@ namespace we
 		SetupShadow();
 		BindInput();
 
+		// Prompts are shown from the event dispatch rather than from inside the physics step
+		OverlapListener = GetWorld().GetEvents().Subscribe(weak_from_this(), &PlayerCharacter::OnOverlap, GetID());
+
 		if (auto CamComp = GetCameraComponent())
 		{
 			CamComp->AttachTo(this);
@@ -105,8 +115,31 @@ namespace we
 		Character::Tick(DeltaTime);
 	}
 
+	void PlayerCharacter::SaveState(SnapshotWriter& Out) const
+	{
+		Character::SaveState(Out);
+		Out.Write(QuestComp.GetState());
+	}
+
+	void PlayerCharacter::LoadState(SnapshotReader& In)
+	{
+		Character::LoadState(In);
+
+		FQuestState Quest;
+		In.Read(Quest);
+		QuestComp.SetState(Quest);
+
+		// Whoever the player was talking to is no longer next to them
+		if (CurrentInteractable)
+		{
+			CurrentInteractable->HidePrompt(this);
+			EndInteraction();
+		}
+	}
+
 	void PlayerCharacter::EndPlay()
 	{
+		GetWorld().GetEvents().Unsubscribe(OverlapListener);
 		Character::EndPlay();
 	}
 
@@ -216,9 +249,25 @@ namespace we
 		bInteractWasPressed = bPressed;
 	}
 
+	void PlayerCharacter::OnOverlap(const OverlapEvent& Event)
+	{
+		// Gone already if it was destroyed and collected since the contact
+		Actor* Other = GetWorld().FindActor(Event.Other);
+		if (!Other) return;
+
+		if (Event.bBegin)
+		{
+			OnBeginOverlap(Other);
+		}
+		else
+		{
+			OnEndOverlap(Other);
+		}
+	}
+
 	void PlayerCharacter::OnBeginOverlap(Actor* Other)
 	{
-		if (auto* Interactable = dynamic_cast<IInteractable*>(Other))
+		if (auto* Interactable = Other->Cast<IInteractable>())
 		{
 			if (!bInDialog)
 			{
@@ -229,7 +278,7 @@ namespace we
 
 	void PlayerCharacter::OnEndOverlap(Actor* Other)
 	{
-		if (auto* Interactable = dynamic_cast<IInteractable*>(Other))
+		if (auto* Interactable = Other->Cast<IInteractable>())
 		{
 			if (Interactable == CurrentInteractable)
 			{
@@ -261,11 +310,11 @@ namespace we
 			if (!Other)
 				continue;
 
-			if (auto* Interactable = dynamic_cast<IInteractable*>(Other))
+			if (auto* Interactable = Other->Cast<IInteractable>())
 			{
 				if (Interactable->CanInteract(this))
 				{
-					StartInteraction(Interactable);
+					StartInteraction(Other, Interactable);
 					Interactable->Interact(this);
 					return;
 				}
@@ -273,15 +322,12 @@ namespace we
 		}
 	}
 
-	void PlayerCharacter::StartInteraction(IInteractable* Target)
+	void PlayerCharacter::StartInteraction(Actor* TargetActor, IInteractable* Target)
 	{
 		CurrentInteractable = Target;
 		bInDialog = true;
 
-		if (auto* TargetActor = dynamic_cast<Actor*>(Target))
-		{
-			FaceInteractionTarget(TargetActor);
-		}
+		FaceInteractionTarget(TargetActor);
 	}
 
 	void PlayerCharacter::EndInteraction()
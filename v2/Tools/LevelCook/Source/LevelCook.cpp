@@ -0,0 +1,61 @@
+// =============================================================================
+// Water Engine v2.1.2 - LevelCook
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/LevelLoader.h"
+#include "Utility/Log.h"
+
+#include <filesystem>
+
+using namespace we;
+
+namespace
+{
+    string GetCookedPath(const std::filesystem::path& SourcePath)
+    {
+        return std::filesystem::path(SourcePath).replace_extension(".welv").string();
+    }
+}
+
+// Cooks a single level, or every .json level below a directory, next to its source
+int main(int Argc, char** Argv)
+{
+    if (Argc < 2)
+    {
+        ERROR("Usage: LevelCook <level.json | directory>");
+        return 1;
+    }
+
+    const std::filesystem::path Input = Argv[1];
+    vector<std::filesystem::path> Sources;
+
+    std::error_code Error;
+    if (std::filesystem::is_directory(Input, Error))
+    {
+        for (const auto& Entry : std::filesystem::recursive_directory_iterator(Input, Error))
+        {
+            if (Entry.is_regular_file() && Entry.path().extension() == ".json")
+            {
+                Sources.push_back(Entry.path());
+            }
+        }
+    }
+    else
+    {
+        Sources.push_back(Input);
+    }
+
+    uint Failed = 0;
+    for (const auto& Source : Sources)
+    {
+        if (!LevelLoader::Cook(Source.string(), GetCookedPath(Source)))
+        {
+            ++Failed;
+        }
+    }
+
+    LOG("[LevelCook] Cooked {} of {} levels", Sources.size() - Failed, Sources.size());
+    return Failed == 0 ? 0 : 1;
+}
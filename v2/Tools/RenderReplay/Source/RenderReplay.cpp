@@ -0,0 +1,182 @@
+// =============================================================================
+// Water Engine v2.1.2 - RenderReplay
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Core/CoreMinimal.h"
+#include "Render/RenderCapture.h"
+#include "Subsystem/RenderSubsystem.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Log.h"
+#include "Utility/Math.h"
+
+#include <cstdlib>
+#include <limits>
+
+using namespace we;
+
+namespace
+{
+    struct ReplayOptions
+    {
+        string CapturePath;
+        string ContentRoot = "Content/";
+        uint Iterations = 10;
+
+        // Dynamic resolution would change the scale between runs, making timings incomparable
+        float ResolutionScale = WEConfig.Render.MaxResolutionScale;
+    };
+
+    optional<ReplayOptions> ParseOptions(int Argc, char** Argv)
+    {
+        if (Argc < 2) return std::nullopt;
+
+        ReplayOptions Options;
+        Options.CapturePath = Argv[1];
+
+        for (int i = 2; i + 1 < Argc; i += 2)
+        {
+            string Flag = Argv[i];
+            if (Flag == "--content")
+            {
+                Options.ContentRoot = Argv[i + 1];
+            }
+            else if (Flag == "--iterations")
+            {
+                Options.Iterations = Max(1u, static_cast<uint>(std::strtoul(Argv[i + 1], nullptr, 10)));
+            }
+            else if (Flag == "--scale")
+            {
+                Options.ResolutionScale = std::strtof(Argv[i + 1], nullptr);
+            }
+        }
+        return Options;
+    }
+
+    // Captured textures are reloaded by resource name; runtime textures get a same-sized placeholder
+    vector<texture> LoadTextures(const RenderCapture& Capture, const string& ContentRoot)
+    {
+        vector<texture> Textures;
+        Textures.reserve(Capture.Textures.size());
+
+        for (const auto& Captured : Capture.Textures)
+        {
+            texture& Texture = Textures.emplace_back();
+            if (!Captured.Name.empty() && Texture.loadFromFile(ContentRoot + Captured.Name))
+                continue;
+
+            image Placeholder(Captured.Size, color::Magenta);
+            if (!Texture.loadFromImage(Placeholder))
+            {
+                WARNING("[Replay] Failed to create placeholder for {}", Captured.Name);
+            }
+        }
+        return Textures;
+    }
+
+    void ReplayFrame(RenderSubsystem& Render, const CapturedFrame& Frame, const vector<texture>& Textures)
+    {
+        float Zoom = Frame.WorldViewSize.x > 0.0f ? Render.GetRenderResolution().x / Frame.WorldViewSize.x : 1.0f;
+        Render.SetWorldView(Frame.WorldViewCenter, Zoom, Frame.WorldViewRotation);
+        Render.BeginFrame();
+
+        for (const auto& Command : Frame.Commands)
+        {
+            const texture* Texture = Command.TextureID < Textures.size() ? &Textures[Command.TextureID] : nullptr;
+
+            sf::RenderStates States;
+            States.blendMode = Command.GetBlendMode();
+            States.transform = Command.GetTransform();
+            States.texture = Texture;
+
+            if (Command.Kind == ECaptureKind::Sprite)
+            {
+                if (!Texture) continue;
+
+                sprite Sprite(*Texture, Command.TextureRect);
+                Sprite.setColor(Command.Tint);
+                States.texture = nullptr;
+                Render.Draw(Sprite, Command.Layer, States);
+            }
+            else
+            {
+                sf::VertexArray Vertices(Command.Primitive, Command.Vertices.size());
+                for (ulong i = 0; i < Command.Vertices.size(); ++i)
+                {
+                    Vertices[i] = Command.Vertices[i];
+                }
+                Render.Draw(Vertices, Command.Layer, States);
+            }
+        }
+
+        Render.EndFrame();
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    auto Options = ParseOptions(Argc, Argv);
+    if (!Options)
+    {
+        ERROR("Usage: RenderReplay <capture.werc> [--content <dir>] [--iterations <n>] [--scale <world resolution scale>]");
+        return 1;
+    }
+
+    RenderCapture Capture;
+    if (!Capture.LoadFromFile(Options->CapturePath) || Capture.Frames.empty())
+    {
+        ERROR("[Replay] Nothing to replay in {}", Options->CapturePath);
+        return 1;
+    }
+
+    RenderSubsystem Render;
+    Render.SetTargetSize(Capture.Resolution);
+    Render.PinWorldResolutionScale(Options->ResolutionScale);
+    vector<texture> Textures = LoadTextures(Capture, Options->ContentRoot);
+
+    ulong CommandCount = 0;
+    for (const auto& Frame : Capture.Frames)
+    {
+        CommandCount += Frame.Commands.size();
+    }
+    LOG("[Replay] {} frames, {} commands, {} textures at {}x{}, world scale {:.2f}",
+        Capture.Frames.size(), CommandCount, Textures.size(), Capture.Resolution.x, Capture.Resolution.y,
+        Render.GetWorldResolutionScale());
+
+    // Warm up driver caches before measuring
+    for (const auto& Frame : Capture.Frames)
+    {
+        ReplayFrame(Render, Frame, Textures);
+    }
+
+    float MinFrame = std::numeric_limits<float>::max();
+    float MaxFrame = 0.0f;
+    float TotalSubmit = 0.0f;
+    we::clock WallClock;
+
+    for (uint Iteration = 0; Iteration < Options->Iterations; ++Iteration)
+    {
+        for (const auto& Frame : Capture.Frames)
+        {
+            we::clock FrameClock;
+            ReplayFrame(Render, Frame, Textures);
+
+            float FrameTime = FrameClock.getElapsedTime().asSeconds() * 1000.0f;
+            MinFrame = Min(MinFrame, FrameTime);
+            MaxFrame = Max(MaxFrame, FrameTime);
+            TotalSubmit += FrameTime;
+        }
+    }
+
+    // Reading back the composite waits for the GPU to finish all queued work
+    (void)Render.GetCompositeSprite().getTexture().copyToImage();
+    float WallTime = WallClock.getElapsedTime().asSeconds() * 1000.0f;
+
+    float FramesReplayed = static_cast<float>(Capture.Frames.size() * Options->Iterations);
+    LOG("[Replay] CPU submit per frame: avg {:.3f} ms, min {:.3f} ms, max {:.3f} ms",
+        TotalSubmit / FramesReplayed, MinFrame, MaxFrame);
+    LOG("[Replay] Wall time per frame incl. GPU: {:.3f} ms over {} iterations",
+        WallTime / FramesReplayed, Options->Iterations);
+
+    return 0;
+}
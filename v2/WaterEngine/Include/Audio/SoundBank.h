@@ -0,0 +1,37 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+    // Sound effects a level needs, decoded up front on worker threads so the
+    // first PlaySFX of each one doesn't hitch
+    class SoundBank
+    {
+    public:
+        SoundBank() = default;
+        explicit SoundBank(vector<string> InSounds, bool bInCompact = false);
+
+        // Short stereo sounds are downmixed to 16-bit mono when compact
+        void Load();
+
+        // Cached buffers are freed on the next resource GC unless still playing
+        void Unload();
+
+        bool IsLoaded() const { return !Buffers.empty(); }
+        const vector<string>& GetSounds() const { return Sounds; }
+
+        // Decoded PCM bytes held by this bank
+        ulong GetMemoryUsage() const;
+
+    private:
+        vector<string> Sounds;
+        vector<shared<soundBuffer>> Buffers;
+        bool bCompact = false;
+    };
+}
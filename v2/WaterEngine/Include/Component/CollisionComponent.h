@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Core/CoreMinimal.h"
+#include "Framework/World/Actor.h"
 #include "Interface/Actor/IActorComponent.h"
 #include "Interface/Physics/IPhysicsContactListener.h"
 #include "Utility/Delegate.h"
@@ -14,6 +15,14 @@ class b2Body;
 
 namespace we
 {
+	// Published on the world's event bus with the overlapping component's owner as source
+	struct OverlapEvent
+	{
+		ActorID Self = INVALID_ACTOR_ID;
+		ActorID Other = INVALID_ACTOR_ID;
+		bool bBegin = true;
+	};
+
 	class CollisionComponent : public IActorComponent, public IPhysicsContactListener
 	{
 	public:
@@ -41,7 +50,8 @@ namespace we
 		bool IsOverlapping() const { return !OverlappingActors.empty(); }
 		bool IsOtherActor(Actor* CheckActor) const;
 
-		// Delegates
+		// Delegates fire immediately, during the physics step. Listeners that would rather not
+		// run there subscribe to OverlapEvent, delivered at the next event dispatch
 		Delegate<Actor*> OnBeginOverlap;
 		Delegate<Actor*> OnEndOverlap;
 		
@@ -54,7 +64,7 @@ namespace we
 		{
 			for (Actor* Other : OverlappingActors)
 			{
-				if (auto* Casted = dynamic_cast<T*>(Other))
+				if (auto* Casted = Other->Cast<T>())
 					return Casted;
 			}
 			return nullptr;
@@ -67,7 +77,7 @@ namespace we
 			vector<T*> Result;
 			for (Actor* Other : OverlappingActors)
 			{
-				if (auto* Casted = dynamic_cast<T*>(Other))
+				if (auto* Casted = Other->Cast<T>())
 					Result.push_back(Casted);
 			}
 			return Result;
@@ -8,6 +8,7 @@
 #include "Core/CoreMinimal.h"
 #include "Interface/Actor/IActorComponent.h"
 #include "Utility/Delegate.h"
+#include "Navigation/FlowField.h"
 
 namespace we
 {
@@ -26,6 +27,24 @@ namespace we
 		void AddInputVector(const vec2f& Direction);
 		void ClearInput();
 
+		// Caps this tick's velocity so the owner covers at most Distance before it ticks again,
+		// assuming the next tick comes as late as this one did. Throttled owners keep their body
+		// velocity between ticks, so without it they run past a destination they were about to reach
+		void LimitTravel(float Distance) { TravelLimit = Distance; }
+
+		// Adds the flow field's direction at the owner's position plus Offset (e.g. the feet)
+		// as input every tick, on top of any other input, until stopped
+		void FollowFlowField(FlowFieldID ID, vec2f Offset = {});
+		void StopFollowingFlowField() { FlowField = INVALID_FLOW_FIELD; }
+		bool IsFollowingFlowField() const { return FlowField != INVALID_FLOW_FIELD; }
+
+		// Joins the world's crowd avoidance as a circle of Radius at the owner's position plus Offset.
+		// Steering agents have their velocity adjusted around the others before it is broadcast;
+		// the rest, usually players, keep their velocity and are only avoided
+		void EnableAvoidance(float Radius, vec2f Offset = {}, bool bSteer = true);
+		void DisableAvoidance() { AvoidanceRadius = 0.0f; }
+		bool IsAvoidanceEnabled() const { return AvoidanceRadius > 0.0f; }
+
 		// Configuration
 		void SetSpeed(float InSpeed) { CurrentSpeed = InSpeed; }
 		float GetSpeed() const { return CurrentSpeed; }
@@ -55,6 +74,11 @@ namespace we
 		Delegate<vec2f> OnVelocityCalculated;
 
 	private:
+		friend class CrowdAvoidance;
+
+		// Called by CrowdAvoidance with the steered velocity
+		void ApplyAvoidance(const vec2f& InVelocity);
+
 		void UpdateOrientation();
 		void ApplyMovement(float DeltaTime);
 		vec2f CalculateVelocity();
@@ -64,6 +88,7 @@ namespace we
 		float CurrentSpeed = 200.0f;
 		vec2f Velocity;
 		vec2f InputVector;
+		optional<float> TravelLimit;
 
 		vec2f ForwardVector{ 0, 1 };
 		vec2f RightVector{ 1, 0 };
@@ -77,6 +102,13 @@ namespace we
 		bool bIsRunning = false;
 		bool bIsSwimming = false;
 
+		FlowFieldID FlowField = INVALID_FLOW_FIELD;
+		vec2f FlowFieldOffset;
+
+		float AvoidanceRadius = 0.0f;
+		vec2f AvoidanceOffset;
+		bool bAvoidanceSteers = true;
+
 		bool bAutoOrient = true;
 		bool bDebugDrawEnabled = false;
 		optional<sf::VertexArray> DebugArrow;
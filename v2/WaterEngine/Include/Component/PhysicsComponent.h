@@ -15,6 +15,9 @@ class b2Body;
 
 namespace we
 {
+    class SnapshotWriter;
+    class SnapshotReader;
+
     class PhysicsComponent : public IActorComponent, public IPhysicsContactListener
     {
     public:
@@ -45,13 +48,20 @@ namespace we
         b2Body* GetBody() const { return Body; }
         bool HasBody() const { return Body != nullptr; }
 
+        // Applied by PhysicsSubsystem in one pass before the next step
         void SetVelocity(vec2f Velocity);
         vec2f GetVelocity() const;
 
-        // Position (syncs body to actor position)
+        // Position. PhysicsSubsystem moves the owner to the body after every step,
+        // so SyncActorToBody is only needed to snap it mid-frame
         void SyncBodyToActor();
         void SyncActorToBody();
         
+        // Snapshots. LoadState queues the body for PhysicsSubsystem::RebuildQueuedBodies,
+        // which recreates it at the restored actor position with the saved velocity
+        void SaveState(SnapshotWriter& Out) const;
+        void LoadState(SnapshotReader& In);
+
         // Shape offset from actor center (in pixels)
         void SetShapeOffset(vec2f Offset);
         vec2f GetShapeOffset() const { return ShapeOffset; }
@@ -74,6 +84,10 @@ namespace we
         void DestroyBody();
         void CreateFixture();
 
+        friend class PhysicsSubsystem;
+
+        static constexpr ulong NotSynced = static_cast<ulong>(-1);
+
     private:
         Actor* Owner;
         b2Body* Body = nullptr;
@@ -86,6 +100,9 @@ namespace we
         float LinearDamping = 10.0f;
         ECollisionChannel CollisionChannel = ECollisionChannel::Physics;
         bool bDebugDrawEnabled = false;
+        vec2f RestoredVelocity{0.0f, 0.0f};
+        optional<vec2f> PendingVelocity;
+        ulong SyncIndex = NotSynced;
         
         optional<circle> DebugCircle;
         optional<rectangle> DebugRect;
@@ -33,6 +33,32 @@ namespace we
         
         // Final window clear color (before displaying composite)
         static constexpr color WindowClearColor = color::Black;
+
+        // Dynamic resolution (world layer only, UI layers stay native)
+        static constexpr bool bDynamicResolution = true;
+        static constexpr float MinResolutionScale = 0.5f;
+        static constexpr float MaxResolutionScale = 1.0f;
+        static constexpr float TargetFrameTime = 1.0f / 60.0f;      // Seconds between presented frames, simulation and GPU waits included
+        static constexpr float FrameTimeSmoothing = 0.1f;           // Weight of the newest sample
+        static constexpr float ResolutionScaleStep = 0.05f;
+        static constexpr float ResolutionAdjustInterval = 0.5f;     // Seconds between adjustments
+
+        // With VSync the frame time never drops below the refresh period, so headroom can't be
+        // measured; the scale is raised after this long on target and lowered again if it misses
+        static constexpr float ResolutionRecoverInterval = 5.0f;
+
+        // Present the world layer on a dedicated thread while the next frame simulates
+        static constexpr bool bUseRenderThread = false;
+
+        // Static actors are pre-rendered into world tiles, split into depth bands
+        // Smaller bands sort more precisely against dynamic actors at the cost of more textures
+        static constexpr bool bStaticLayerCache = true;
+        static constexpr uint StaticTileSize = 1024;
+        static constexpr float StaticDepthBandSize = 32.0f;
+
+        // Render capture for offline replay (see Tools/RenderReplay)
+        static constexpr uint CaptureFrameCount = 300;
+        static constexpr const char* CaptureFileName = "RenderCapture.werc";
     };
 
     // =========================================================================
@@ -106,17 +132,32 @@ namespace we
         #ifdef USE_PACKED_ASSETS
         static constexpr stringView AssetPackPath = ASSET_PACK_PATH;
         #endif
+
+        // Read buffer for assets streamed from the pack (music)
+        // Store streamed files uncompressed in the pack, backward seeks inside deflated entries re-inflate from the start
+        static constexpr uint StreamBufferSize = 64 * 1024;
     };
 
     // =========================================================================
     // Save System Configuration
     // =========================================================================
+    enum class ESaveFormat : uint8
+    {
+        Json,           // Human readable, for debugging
+        MessagePack,
+        Cbor
+    };
+
     struct SaveConfig
     {
         // Company and game names for save location
         static constexpr const char* CompanyName = "WaterEngine";
         static constexpr const char* GameName = "WaterEngine";
-        static constexpr const char* SaveFileName = "Save.json";
+        static constexpr const char* SaveFileName = "Save.dat";
+        static constexpr const char* LegacySaveFileName = "Save.json";     // Read once if no save exists yet
+
+        // Encoding used when writing; loading detects any of them
+        static constexpr ESaveFormat SaveFormat = ESaveFormat::MessagePack;
         
         // Platform-specific save paths
         #ifdef _WIN32
@@ -145,6 +186,47 @@ namespace we
         
         // Hotkey bindings (scancodes)
         static constexpr sf::Keyboard::Scan FullscreenKey = sf::Keyboard::Scan::F11;
+        static constexpr sf::Keyboard::Scan RenderCaptureKey = sf::Keyboard::Scan::F9;
+        static constexpr sf::Keyboard::Scan InputRecordKey = sf::Keyboard::Scan::F7;    // Toggles recording
+        static constexpr sf::Keyboard::Scan InputReplayKey = sf::Keyboard::Scan::F8;    // Toggles replay
+
+        // Recent input events kept for inspection
+        static constexpr uint EventHistorySize = 256;
+        static constexpr const char* InputRecordingFileName = "InputRecording.weir";
+    };
+
+    // =========================================================================
+    // Audio Configuration
+    // =========================================================================
+    struct AudioConfig
+    {
+        // Sound voices shared by the SFX and Voice channels, allocated once at startup
+        static constexpr uint VoicePoolSize = 32;
+
+        // Simultaneous instances of one sound before its oldest instance is restarted
+        // Override per sound with AudioSubsystem::SetSoundConcurrency
+        static constexpr uint MaxInstancesPerSound = 4;
+
+        // Sound banks with compact storage downmix sounds up to this length to mono
+        static constexpr float CompactSoundMaxDuration = 2.0f;
+
+        // Positional SFX, in pixels from the camera view position
+        // Full volume inside FullVolumeRadius, silent and culled beyond AudibleRadius
+        static constexpr float FullVolumeRadius = 200.0f;
+        static constexpr float AudibleRadius = 1600.0f;
+
+        // Horizontal offset at which a sound reaches MaxPan
+        static constexpr float PanDistance = 960.0f;
+        static constexpr float MaxPan = 0.8f;
+
+        // Positional triggers of one sound in the same frame only merge within a cell of this size
+        static constexpr float TriggerMergeDistance = 64.0f;
+
+        // Fades and voice management run on a dedicated thread at a fixed rate,
+        // fed by a lock-free command queue from the game thread
+        static constexpr bool bUseAudioThread = true;
+        static constexpr float AudioUpdateRate = 200.0f;            // Hz
+        static constexpr uint CommandQueueCapacity = 256;
     };
 
     // =========================================================================
@@ -187,6 +269,94 @@ namespace we
         static constexpr int PositionIterations = 3;
     };
 
+    // =========================================================================
+    // World Configuration
+    // =========================================================================
+    struct WorldConfig
+    {
+        // Edge length of a world partition cell in pixels
+        static constexpr float StreamingCellSize = 1024.0f;
+
+        // Cells closer than this to the camera are streamed in
+        static constexpr float StreamingLoadRadius = 2048.0f;
+
+        // Extra distance before a loaded cell streams out, so cells at the edge don't thrash
+        static constexpr float StreamingUnloadHysteresis = 768.0f;
+
+        // Time per frame spent loading and unloading cells; one step always runs
+        static constexpr float StreamingBudgetMs = 2.0f;
+
+        // Significance tiers by distance from the camera view in pixels. Actors in view tick
+        // every frame, the rest tick at the interval of the first tier they fall within
+        static constexpr array<float, 2> SignificanceDistances{ 1024.0f, 3072.0f };
+        static constexpr array<float, 3> SignificanceTickIntervals{ 1.0f / 30.0f, 1.0f / 10.0f, 1.0f / 2.0f };
+
+        // Actors whose position is this close to the view still count as in view, so large
+        // sprites crossing the edge keep animating
+        static constexpr float SignificanceViewMargin = 256.0f;
+
+        // Reduced-rate ticks allowed per frame, 0 = unlimited. Deferred actors keep
+        // accumulating time and go first next frame
+        static constexpr uint MaxThrottledTicksPerFrame = 64;
+
+        // Time per frame spent loading assets for tasks waiting on WaitForAsset; one load always runs
+        static constexpr float TaskAssetBudgetMs = 2.0f;
+    };
+
+    // =========================================================================
+    // Navigation Configuration
+    // =========================================================================
+    struct NavigationConfig
+    {
+        // Edge length of a walkability grid cell in pixels
+        static constexpr float CellSize = 32.0f;
+
+        // Clearance kept from static collision, about the radius of a character's body
+        static constexpr float AgentRadius = 32.0f;
+
+        // A search gives up after expanding this many cells
+        static constexpr uint MaxSearchNodes = 200000;
+
+        // Starts and goals inside inflated obstacles move to open ground up to this many cells away
+        static constexpr int SnapRadius = 4;
+
+        // Finished paths kept for identical requests until the grid changes
+        static constexpr uint MaxCachedPaths = 256;
+    };
+
+    // =========================================================================
+    // Crowd Avoidance Configuration
+    // =========================================================================
+    struct CrowdConfig
+    {
+        // Edge length of a spatial hash cell in pixels, about twice the largest agent radius
+        static constexpr float CellSize = 128.0f;
+
+        // Extra gap agents try to keep between their circles
+        static constexpr float Padding = 8.0f;
+
+        // How far ahead in seconds agents look for collisions with each other
+        static constexpr float TimeHorizon = 0.75f;
+
+        // Scales how hard agents turn away from each other
+        static constexpr float Strength = 1.0f;
+
+        // Nearest neighbors each agent considers, so crowded spots cost the same as sparse ones
+        static constexpr uint MaxNeighbors = 8;
+
+        // Agents per frame before avoidance is split across threads
+        static constexpr uint ParallelThreshold = 256;
+    };
+
+    // =========================================================================
+    // Job System Configuration
+    // =========================================================================
+    struct JobConfig
+    {
+        // Persistent worker threads shared by engine systems, 0 = one less than the hardware threads
+        static constexpr uint WorkerThreads = 0;
+    };
+
     // =========================================================================
     // Master Engine Configuration
     // =========================================================================
@@ -199,8 +369,13 @@ namespace we
         ResourceConfig Resource;
         SaveConfig Save;
         InputConfig Input;
+        AudioConfig Audio;
         TimingConfig Timing;
         PhysicsConfig Physics;
+        WorldConfig World;
+        NavigationConfig Navigation;
+        CrowdConfig Crowd;
+        JobConfig Jobs;
     };
 }
 
@@ -20,6 +20,7 @@
 #include "Subsystem/SaveSubsystem.h"
 #include "Subsystem/AudioSubsystem.h"
 #include "Subsystem/PhysicsSubsystem.h"
+#include "Subsystem/NavigationSubsystem.h"
 
 namespace we
 {
@@ -38,6 +39,7 @@ namespace we
 		unique<GUISubsystem>		GUI;
 		shared<SaveSubsystem>		Save;
 		shared<PhysicsSubsystem>	Physics;
+		shared<NavigationSubsystem>	Navigation;
 		shared<GameInstance>		GameInstance;
 	};
 }
\ No newline at end of file
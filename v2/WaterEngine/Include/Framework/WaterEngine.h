@@ -8,6 +8,7 @@
 #include "Core/CoreMinimal.h"
 #include "Framework/EngineSubsystem.h"
 #include "Core/EngineConfig.h"
+#include "Render/RenderThread.h"
 
 namespace we
 {
@@ -35,5 +36,13 @@ namespace we
     private:
         void Initialize();
         void BindDelegates();
+        void HandleDebugHotkey(sf::Keyboard::Scan Key);
+
+        void RenderThreaded();
+        void BuildRenderFrame(RenderFrame& Frame);
+        void DrawUILayers();
+
+        // Only created when RenderConfig::bUseRenderThread is set
+        unique<RenderThread> RenderWorker;
     };
 }
\ No newline at end of file
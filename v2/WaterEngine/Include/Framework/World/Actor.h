@@ -8,9 +8,34 @@
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Object.h"
 
+#include <bitset>
+#include <cstddef>
+
 namespace we
 {
 	class World;
+	class SnapshotWriter;
+	class SnapshotReader;
+
+	// Small sequential ID per C++ type, assigned on first use. ID 0 means unknown
+	using TypeID = uint;
+	constexpr TypeID INVALID_TYPE_ID = 0;
+
+	namespace Detail
+	{
+		TypeID NextTypeID();
+	}
+
+	template<typename T>
+	TypeID GetTypeID()
+	{
+		static const TypeID ID = Detail::NextTypeID();
+		return ID;
+	}
+
+	// Games number their own tags, usually with an enum class
+	constexpr uint MAX_ACTOR_TAGS = 64;
+	using ActorTags = std::bitset<MAX_ACTOR_TAGS>;
 
 	class Actor : public Object
 	{
@@ -24,6 +49,32 @@ namespace we
 
 		ActorID GetID() const { return UniqueID; }
 
+		// Concrete type, recorded by World::SpawnActor
+		TypeID GetActorType() const { return ConcreteType; }
+
+		// Type checks without walking RTTI. Answers are cached per concrete type and target, so only
+		// the first check of each pair uses dynamic_cast. Works for actor classes and interfaces alike
+		template<typename T>
+		bool IsA() const { return Cast<T>() != nullptr; }
+
+		template<typename T>
+		T* Cast();
+
+		template<typename T>
+		const T* Cast() const { return const_cast<Actor*>(this)->Cast<T>(); }
+
+		// Tags are indexed by the world, see World::ForEachActorWithTag
+		template<typename TagType>
+		void AddTag(TagType Tag) { SetTag(static_cast<uint>(Tag), true); }
+
+		template<typename TagType>
+		void RemoveTag(TagType Tag) { SetTag(static_cast<uint>(Tag), false); }
+
+		template<typename TagType>
+		bool HasTag(TagType Tag) const { return Tags.test(static_cast<uint>(Tag)); }
+
+		const ActorTags& GetTags() const { return Tags; }
+
 		virtual void BeginPlay();
 		virtual void Tick(float DeltaTime);
 		virtual void EndPlay();
@@ -31,9 +82,9 @@ namespace we
 	public:
 
 		// Transform
-		void SetPosition(const vec2f& NewPosition) { Position = NewPosition; }
-		void SetRotation(angle NewRotation) { Rotation = NewRotation; }
-		void SetScale(const vec2f& NewScale) { Scale = NewScale; }
+		void SetPosition(const vec2f& NewPosition) { Position = NewPosition; if (bIsStatic) MarkRenderStateChanged(); }
+		void SetRotation(angle NewRotation) { Rotation = NewRotation; if (bIsStatic) MarkRenderStateChanged(); }
+		void SetScale(const vec2f& NewScale) { Scale = NewScale; if (bIsStatic) MarkRenderStateChanged(); }
 		vec2f GetPosition() const { return Position; }
 		angle GetRotation() const { return Rotation; }
 		vec2f GetScale() const { return Scale; }
@@ -44,6 +95,7 @@ namespace we
 		void SetSpriteOrigin(const vec2f& Origin);
 		void SetTextureRect(const recti& TexRect);
 		bool HasSprite() const { return ActorSprite.has_value(); }
+		const shared<texture>& GetSpriteTexture() const { return SpriteTexture; }
 		const drawable* GetDrawable() const;
 		
 		// Collect all drawables (sprite + debug shapes)
@@ -51,19 +103,72 @@ namespace we
 
 		// Render Depth
 		float GetRenderDepth() const { return CustomDepth.value_or(Position.y); }
-		void SetCustomRenderDepth(float Depth) { CustomDepth = Depth; }
+		void SetCustomRenderDepth(float Depth) { CustomDepth = Depth; if (bIsStatic) MarkRenderStateChanged(); }
 		bool HasCustomRenderDepth() const { return CustomDepth.has_value(); }
 
 		// Visibility
-		void SetVisible(bool bVisible) { bIsVisible = bVisible; }
+		void SetVisible(bool bVisible) { bIsVisible = bVisible; if (bIsStatic) MarkRenderStateChanged(); }
 		bool IsVisible() const { return bIsVisible; }
 
+		// Static actors are drawn from the cached static layer instead of every frame
+		void SetStatic(bool bStatic);
+		bool IsStatic() const { return bIsStatic; }
+
+		// The static layer only re-renders an actor's tiles when told it changed. The setters above
+		// call this; static actors that change their own drawables in GetDrawables call it too
+		void MarkRenderStateChanged();
+
+		// Snapshots. Only opted-in actors are captured by World::CaptureSnapshot
+		void SetSnapshotEnabled(bool bEnabled) { bSnapshotEnabled = bEnabled; }
+		bool IsSnapshotEnabled() const { return bSnapshotEnabled; }
+
+		// Overrides call the base first, then write their own gameplay state in a fixed order
+		virtual void SaveState(SnapshotWriter& Out) const;
+		virtual void LoadState(SnapshotReader& In);
+
+		// Significance. Always-relevant actors tick every frame wherever they are
+		void SetAlwaysRelevant(bool bRelevant) { bAlwaysRelevant = bRelevant; }
+		bool IsAlwaysRelevant() const { return bAlwaysRelevant; }
+
+		// Near or inside the camera view and visible, as of the last world tick
+		bool IsInView() const { return bIsInView; }
+
+		// Delta this actor ticked with in the current frame, nullopt if it did not tick.
+		// Component systems use it so components follow their owner's tick rate
+		optional<float> GetFrameTickDelta() const;
+
 		World& GetWorld() const { return OwningWorld; }
 
+	protected:
+		void OnPendingDestroy() override;
+
+	private:
+		// Cached dynamic_cast result: whether the cast succeeds and how far the result is from this
+		struct CastEntry
+		{
+			bool bValid = false;
+			std::ptrdiff_t Offset = 0;
+		};
+
+		const CastEntry& FindCast(TypeID Target, const void* (*Resolve)(Actor&));
+		void SetTag(uint Tag, bool bSet);
+
 	private:
 		static ActorID NextID;
 		const ActorID UniqueID;
 
+		// Shared by every world, as a concrete type always relates to a target the same way.
+		// Rows by concrete type, columns by target type; game thread only
+		static vector<vector<optional<CastEntry>>> CastCache;
+
+		friend class World;
+		TypeID ConcreteType = INVALID_TYPE_ID;
+		ActorTags Tags;
+
+		// Position in the world's type list, for constant-time removal
+		uint TypeListIndex = 0;
+		bool bIndexed = false;
+
 		World& OwningWorld;
 
 		// Transform
@@ -73,8 +178,36 @@ namespace we
 
 		// Render
 		optional<sprite> ActorSprite;
+		shared<texture> SpriteTexture;
 		optional<float> CustomDepth;
 		bool bIsVisible;
+		bool bIsStatic;
+		bool bRenderStateQueued;
 		bool bHasBegunPlay;
+		bool bSnapshotEnabled;
+
+		// Significance
+		friend class SignificanceManager;
+		float TickAccumulator;
+		bool bAlwaysRelevant;
+		bool bIsInView;
+
+		ulong LastTickFrame;
+		float LastTickDelta;
 	};
+
+	template<typename T>
+	inline T* Actor::Cast()
+	{
+		if constexpr (std::is_base_of_v<T, Actor>)
+		{
+			return this;
+		}
+		else
+		{
+			const CastEntry& Entry = FindCast(GetTypeID<T>(), [](Actor& Self) -> const void* { return dynamic_cast<T*>(&Self); });
+			if (!Entry.bValid) return nullptr;
+			return reinterpret_cast<T*>(reinterpret_cast<std::byte*>(this) + Entry.Offset);
+		}
+	}
 }
\ No newline at end of file
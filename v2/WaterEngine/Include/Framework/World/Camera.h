@@ -7,6 +7,7 @@
 
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Actor.h"
+#include "Framework/World/ComponentRegistry.h"
 
 namespace we
 {
@@ -19,7 +20,6 @@ namespace we
 		~Camera();
 
 		void BeginPlay() override;
-		void Tick(float DeltaTime) override;
 		void EndPlay() override;
 
 		CameraComponent* GetCameraComponent() const;
@@ -28,6 +28,6 @@ namespace we
 		bool IsActive() const;
 
 	private:
-		shared<CameraComponent> CamComp;
+		ComponentHandle<CameraComponent> CamComp;
 	};
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Actor.h"
+#include "Framework/World/ComponentRegistry.h"
 
 namespace we
 {
@@ -16,6 +17,8 @@ namespace we
 	class CollisionComponent;
 	class CameraComponent;
 
+	// Components live in the world's ComponentRegistry and tick there after the actor;
+	// the character only holds handles to them
 	class Character : public Actor
 	{
 	public:
@@ -23,21 +26,25 @@ namespace we
 		~Character();
 
 		void BeginPlay() override;
-		void Tick(float DeltaTime) override;
 		void EndPlay() override;
 		void GetDrawables(vector<const drawable*>& OutDrawables) const override;
+		void SaveState(SnapshotWriter& Out) const override;
+		void LoadState(SnapshotReader& In) override;
 
-		shared<AnimationComponent> GetAnimationComponent() const { return AnimComp; }
-		shared<PhysicsComponent> GetPhysicsComponent() const { return PhysicsComp; }
-		shared<MovementComponent> GetMovementComponent() const { return MoveComp; }
-		shared<CollisionComponent> GetCollisionComponent() const { return CollComp; }
-		shared<CameraComponent> GetCameraComponent() const { return CameraComp; }
+		ComponentHandle<AnimationComponent> GetAnimationComponent() const { return AnimComp; }
+		ComponentHandle<PhysicsComponent> GetPhysicsComponent() const { return PhysicsComp; }
+		ComponentHandle<MovementComponent> GetMovementComponent() const { return MoveComp; }
+		ComponentHandle<CollisionComponent> GetCollisionComponent() const { return CollComp; }
+		ComponentHandle<CameraComponent> GetCameraComponent() const { return CameraComp; }
 
 	protected:
-		shared<AnimationComponent> AnimComp;
-		shared<PhysicsComponent> PhysicsComp;
-		shared<MovementComponent> MoveComp;
-		shared<CollisionComponent> CollComp;
-		shared<CameraComponent> CameraComp;
+		ComponentHandle<AnimationComponent> AnimComp;
+		ComponentHandle<PhysicsComponent> PhysicsComp;
+		ComponentHandle<MovementComponent> MoveComp;
+		ComponentHandle<CollisionComponent> CollComp;
+		ComponentHandle<CameraComponent> CameraComp;
+
+	private:
+		void ReleaseComponents();
 	};
 }
\ No newline at end of file
@@ -0,0 +1,222 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/Actor.h"
+
+#include <typeindex>
+
+namespace we
+{
+	template<typename T>
+	class ComponentPool;
+
+	// Lightweight reference to a pooled component. Resolves to null once the component is destroyed
+	template<typename T>
+	class ComponentHandle
+	{
+	public:
+		ComponentHandle() = default;
+
+		T* Get() const { return Pool ? Pool->Find(Index, Generation) : nullptr; }
+		T* operator->() const { return Get(); }
+		T& operator*() const { return *Get(); }
+		explicit operator bool() const { return Get() != nullptr; }
+
+	private:
+		friend class ComponentPool<T>;
+
+		ComponentHandle(ComponentPool<T>* InPool, uint InIndex, uint InGeneration)
+			: Pool{ InPool }, Index{ InIndex }, Generation{ InGeneration }
+		{
+		}
+
+	private:
+		ComponentPool<T>* Pool = nullptr;
+		uint Index = 0;
+		uint Generation = 0;
+	};
+
+	class IComponentPool
+	{
+	public:
+		virtual ~IComponentPool() = default;
+
+		// Ticks every component whose owner ticked this frame, with the owner's delta
+		virtual void TickAll() = 0;
+		virtual ulong GetCount() const = 0;
+	};
+
+	// Stores every component of one type in fixed-size chunks. Chunks never move, so the raw
+	// pointers handed to Box2D user data and delegates stay valid; freed slots are reused first
+	template<typename T>
+	class ComponentPool : public IComponentPool
+	{
+	public:
+		static constexpr uint ChunkSize = 64;
+
+		template<typename... Args>
+		ComponentHandle<T> Create(Args&&... args);
+		void Destroy(const ComponentHandle<T>& Handle);
+
+		T* Find(uint Index, uint Generation) const;
+
+		void TickAll() override;
+		ulong GetCount() const override { return LiveCount; }
+
+		template<typename Func>
+		void ForEach(Func&& Visit);
+
+	private:
+		struct Chunk
+		{
+			array<optional<T>, ChunkSize> Slots;
+			array<uint, ChunkSize> Generations{};
+		};
+
+	private:
+		vector<unique<Chunk>> Chunks;
+		vector<uint> FreeSlots;
+		uint SlotCount = 0;
+		ulong LiveCount = 0;
+	};
+
+	// Owns a pool per component type and runs them as systems, one type at a time, in
+	// registration order. The engine registers movement, physics, collision, animation and camera
+	class ComponentRegistry
+	{
+	public:
+		ComponentRegistry();
+
+		ComponentRegistry(const ComponentRegistry&) = delete;
+		ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+
+		// Types not registered up front tick after the engine systems, in order of first use
+		template<typename T>
+		ComponentPool<T>& GetPool();
+
+		template<typename T, typename... Args>
+		ComponentHandle<T> Create(Args&&... args) { return GetPool<T>().Create(std::forward<Args>(args)...); }
+
+		// Destroys the component and clears the handle; null handles are ignored
+		template<typename T>
+		void Destroy(ComponentHandle<T>& Handle);
+
+		// Called by the world once every actor has ticked
+		void TickSystems();
+
+	private:
+		dictionary<std::type_index, unique<IComponentPool>> Pools;
+		vector<IComponentPool*> TickOrder;
+	};
+
+	template<typename T>
+	template<typename... Args>
+	inline ComponentHandle<T> ComponentPool<T>::Create(Args&&... args)
+	{
+		uint Index = 0;
+		if (!FreeSlots.empty())
+		{
+			Index = FreeSlots.back();
+			FreeSlots.pop_back();
+		}
+		else
+		{
+			if (SlotCount == Chunks.size() * ChunkSize)
+			{
+				Chunks.push_back(make_unique<Chunk>());
+			}
+			Index = SlotCount++;
+		}
+
+		Chunk& Storage = *Chunks[Index / ChunkSize];
+		Storage.Slots[Index % ChunkSize].emplace(std::forward<Args>(args)...);
+		++LiveCount;
+		return ComponentHandle<T>(this, Index, Storage.Generations[Index % ChunkSize]);
+	}
+
+	template<typename T>
+	inline void ComponentPool<T>::Destroy(const ComponentHandle<T>& Handle)
+	{
+		if (!Find(Handle.Index, Handle.Generation)) return;
+
+		Chunk& Storage = *Chunks[Handle.Index / ChunkSize];
+		Storage.Slots[Handle.Index % ChunkSize].reset();
+
+		// Outstanding handles to this slot go stale
+		++Storage.Generations[Handle.Index % ChunkSize];
+		FreeSlots.push_back(Handle.Index);
+		--LiveCount;
+	}
+
+	template<typename T>
+	inline T* ComponentPool<T>::Find(uint Index, uint Generation) const
+	{
+		if (Index >= SlotCount) return nullptr;
+
+		Chunk& Storage = *Chunks[Index / ChunkSize];
+		auto& Slot = Storage.Slots[Index % ChunkSize];
+		if (!Slot || Storage.Generations[Index % ChunkSize] != Generation)
+			return nullptr;
+
+		return &*Slot;
+	}
+
+	template<typename T>
+	inline void ComponentPool<T>::TickAll()
+	{
+		ForEach([](T& Component)
+		{
+			// Owners throttled by the significance manager skip this frame, and catch up with
+			// their accumulated delta on the frame they tick
+			Actor* Owner = Component.GetOwner();
+			if (!Owner) return;
+
+			if (auto Delta = Owner->GetFrameTickDelta())
+			{
+				Component.Tick(*Delta);
+			}
+		});
+	}
+
+	template<typename T>
+	template<typename Func>
+	inline void ComponentPool<T>::ForEach(Func&& Visit)
+	{
+		// By index, so components created while visiting are safe and visited too
+		for (uint Index = 0; Index < SlotCount; ++Index)
+		{
+			auto& Slot = Chunks[Index / ChunkSize]->Slots[Index % ChunkSize];
+			if (Slot)
+			{
+				Visit(*Slot);
+			}
+		}
+	}
+
+	template<typename T>
+	inline ComponentPool<T>& ComponentRegistry::GetPool()
+	{
+		auto It = Pools.find(std::type_index(typeid(T)));
+		if (It == Pools.end())
+		{
+			auto NewPool = make_unique<ComponentPool<T>>();
+			TickOrder.push_back(NewPool.get());
+			It = Pools.emplace(std::type_index(typeid(T)), std::move(NewPool)).first;
+		}
+		return static_cast<ComponentPool<T>&>(*It->second);
+	}
+
+	template<typename T>
+	inline void ComponentRegistry::Destroy(ComponentHandle<T>& Handle)
+	{
+		if (!Handle) return;
+
+		GetPool<T>().Destroy(Handle);
+		Handle = {};
+	}
+}
@@ -0,0 +1,51 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+	class MovementComponent;
+
+	// Steers moving agents around each other before their velocity reaches physics, so crowds
+	// part smoothly instead of shoving through Box2D contacts. Agents are gathered each frame
+	// into a spatial hash; each one looks at its nearest few neighbors and predicts collisions
+	class CrowdAvoidance
+	{
+	public:
+		// Called by movement components as they tick. Agents that don't steer are still avoided
+		void Submit(MovementComponent& Agent, vec2f Position, vec2f Velocity, float Radius, bool bSteers);
+
+		// Adjusts every steering agent's velocity and hands it back to its component.
+		// Called by the world once all components have ticked
+		void Resolve();
+
+		ulong GetAgentCount() const { return Agents.size(); }
+
+	private:
+		void BuildHash();
+		vec2f ComputeVelocity(ulong Index) const;
+
+		vec2i GetCell(vec2f Position) const;
+		uint GetBucket(vec2i Cell) const;
+
+	private:
+		vector<MovementComponent*> Agents;
+		vector<vec2f> Positions;
+		vector<vec2f> Velocities;
+		vector<float> Radii;
+		vector<uint8> Steers;
+		vector<vec2f> Adjusted;
+		float MaxRadius = 0.0f;
+
+		// Counting-sort hash: agents of bucket B are Sorted[BucketStart[B]] up to BucketStart[B + 1]
+		vector<vec2i> Cells;
+		vector<uint> BucketStart;
+		vector<uint> Sorted;
+		uint BucketMask = 0;
+	};
+}
@@ -0,0 +1,254 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/Object.h"
+
+namespace we
+{
+	// Refers to one subscription. ID 0 never refers to a listener
+	struct EventListener
+	{
+		uint Type = 0;
+		uint ID = 0;
+	};
+
+	namespace Detail
+	{
+		uint NextEventType();
+	}
+
+	// Small sequential ID per event struct, assigned on first use. Indexes the bus's channels
+	template<typename EventType>
+	uint GetEventType()
+	{
+		static const uint Type = Detail::NextEventType();
+		return Type;
+	}
+
+	// Deferred, typed notifications. Publish only queues the event in its type's channel;
+	// listeners hear about it when the world dispatches, so nothing runs in the middle of
+	// contact processing or another system's update. Each listener gets the whole batch of
+	// its type at once, optionally filtered to events published for one actor
+	class EventBus
+	{
+	public:
+		EventBus() = default;
+
+		EventBus(const EventBus&) = delete;
+		EventBus& operator=(const EventBus&) = delete;
+
+		// Source is the actor the event is about, matched against listener filters
+		template<typename EventType>
+		void Publish(EventType Event, ActorID Source = INVALID_ACTOR_ID);
+
+		// Calls Callback on Owner for each event of its type. A filtered listener only hears events
+		// published with that Source. Listeners whose owner is destroyed are skipped and dropped
+		template<typename ClassName, typename EventType>
+		EventListener Subscribe(weak<Object> Owner, void(ClassName::* Callback)(const EventType&), ActorID Filter = INVALID_ACTOR_ID);
+
+		void Unsubscribe(EventListener Listener);
+
+		// Delivers everything queued so far. Events published by listeners wait for the next dispatch
+		void Dispatch();
+
+		ulong GetQueuedCount() const;
+
+	private:
+		class IChannel
+		{
+		public:
+			virtual ~IChannel() = default;
+			virtual void TakeQueued() = 0;
+			virtual void Deliver() = 0;
+			virtual void Remove(uint ID) = 0;
+			virtual ulong GetQueuedCount() const = 0;
+		};
+
+		template<typename EventType>
+		class Channel : public IChannel
+		{
+		public:
+			struct Listener
+			{
+				uint ID = 0;
+				ActorID Filter = INVALID_ACTOR_ID;
+				weak<Object> Owner;
+				std::function<void(Object&, const EventType&)> Callback;
+				bool bRemoved = false;
+			};
+
+			void TakeQueued() override;
+			void Deliver() override;
+			void Remove(uint ID) override;
+			ulong GetQueuedCount() const override { return Queue.size(); }
+
+			// Events and their sources side by side, each contiguous
+			vector<EventType> Queue;
+			vector<ActorID> Sources;
+			vector<EventType> Batch;
+			vector<ActorID> BatchSources;
+
+			// Batch indices ordered by source, so a filtered listener visits only its own events
+			vector<std::pair<ActorID, uint>> BySource;
+
+			vector<Listener> Listeners;
+			vector<Listener> Added;
+			bool bDelivering = false;
+			bool bHasRemoved = false;
+		};
+
+		template<typename EventType>
+		Channel<EventType>& GetChannel();
+
+	private:
+		vector<unique<IChannel>> Channels;
+		uint NextListenerID = 1;
+		bool bDispatching = false;
+	};
+
+	template<typename EventType>
+	inline void EventBus::Publish(EventType Event, ActorID Source)
+	{
+		auto& Target = GetChannel<EventType>();
+		Target.Queue.push_back(std::move(Event));
+		Target.Sources.push_back(Source);
+	}
+
+	template<typename ClassName, typename EventType>
+	inline EventListener EventBus::Subscribe(weak<Object> Owner, void(ClassName::* Callback)(const EventType&), ActorID Filter)
+	{
+		typename Channel<EventType>::Listener NewListener;
+		NewListener.ID = NextListenerID++;
+		NewListener.Filter = Filter;
+		NewListener.Owner = std::move(Owner);
+		NewListener.Callback = [Callback](Object& Target, const EventType& Event)
+		{
+			(static_cast<ClassName&>(Target).*Callback)(Event);
+		};
+
+		auto& Target = GetChannel<EventType>();
+		const EventListener Handle{ GetEventType<EventType>(), NewListener.ID };
+
+		// Joining mid-delivery would move the listener being called, so it waits for the next batch
+		if (Target.bDelivering)
+		{
+			Target.Added.push_back(std::move(NewListener));
+		}
+		else
+		{
+			Target.Listeners.push_back(std::move(NewListener));
+		}
+		return Handle;
+	}
+
+	template<typename EventType>
+	inline EventBus::Channel<EventType>& EventBus::GetChannel()
+	{
+		const uint Type = GetEventType<EventType>();
+		if (Type >= Channels.size())
+		{
+			Channels.resize(Type + 1);
+		}
+		if (!Channels[Type])
+		{
+			Channels[Type] = make_unique<Channel<EventType>>();
+		}
+		return static_cast<Channel<EventType>&>(*Channels[Type]);
+	}
+
+	template<typename EventType>
+	inline void EventBus::Channel<EventType>::TakeQueued()
+	{
+		Batch.clear();
+		BatchSources.clear();
+		std::swap(Queue, Batch);
+		std::swap(Sources, BatchSources);
+	}
+
+	template<typename EventType>
+	inline void EventBus::Channel<EventType>::Deliver()
+	{
+		if (!Batch.empty())
+		{
+			const bool bAnyFiltered = std::any_of(Listeners.begin(), Listeners.end(),
+				[](const Listener& Entry) { return Entry.Filter != INVALID_ACTOR_ID; });
+			if (bAnyFiltered)
+			{
+				BySource.clear();
+				for (uint i = 0; i < Batch.size(); ++i)
+				{
+					BySource.emplace_back(BatchSources[i], i);
+				}
+				// Sorting the pairs keeps each source's events in publish order
+				std::sort(BySource.begin(), BySource.end());
+			}
+
+			bDelivering = true;
+			for (ulong l = 0; l < Listeners.size(); ++l)
+			{
+				// Held for the batch so a listener destroying its own owner stays valid until it returns
+				auto Owner = Listeners[l].Owner.lock();
+				if (!Owner || Owner->IsPendingDestroy())
+				{
+					Listeners[l].bRemoved = true;
+					bHasRemoved = true;
+					continue;
+				}
+
+				const ActorID Filter = Listeners[l].Filter;
+				if (Filter == INVALID_ACTOR_ID)
+				{
+					for (ulong i = 0; i < Batch.size() && !Listeners[l].bRemoved; ++i)
+					{
+						Listeners[l].Callback(*Owner, Batch[i]);
+					}
+					continue;
+				}
+
+				auto It = std::lower_bound(BySource.begin(), BySource.end(), std::pair<ActorID, uint>{ Filter, 0 });
+				for (; It != BySource.end() && It->first == Filter && !Listeners[l].bRemoved; ++It)
+				{
+					Listeners[l].Callback(*Owner, Batch[It->second]);
+				}
+			}
+			bDelivering = false;
+		}
+
+		if (bHasRemoved)
+		{
+			std::erase_if(Listeners, [](const Listener& Entry) { return Entry.bRemoved; });
+			bHasRemoved = false;
+		}
+		for (auto& Entry : Added)
+		{
+			Listeners.push_back(std::move(Entry));
+		}
+		Added.clear();
+	}
+
+	template<typename EventType>
+	inline void EventBus::Channel<EventType>::Remove(uint ID)
+	{
+		for (auto& Entry : Listeners)
+		{
+			if (Entry.ID == ID)
+			{
+				// Erased after delivery, so the loop over listeners is never reshuffled
+				Entry.bRemoved = true;
+				bHasRemoved = true;
+				if (!bDelivering)
+				{
+					std::erase_if(Listeners, [](const Listener& Other) { return Other.bRemoved; });
+					bHasRemoved = false;
+				}
+				return;
+			}
+		}
+		std::erase_if(Added, [ID](const Listener& Entry) { return Entry.ID == ID; });
+	}
+}
@@ -0,0 +1,85 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+	// Index into LevelData::Strings, or NoString
+	using LevelString = int;
+	inline constexpr LevelString NoString = -1;
+
+	// Sprite with an optional shadow sprite and an optional static collision circle
+	struct LevelProp
+	{
+		vec2f Position{};
+		vec2f Origin{};
+		vec2f CollisionOffset{};
+		float CollisionRadius = 0.0f;		// 0 = no collision
+		float Depth = 0.0f;
+		float ShadowDepth = 0.0f;
+		LevelString Texture = NoString;
+		LevelString Shadow = NoString;
+		bool bHasDepth = false;
+		bool bPersistent = false;			// Never streamed out, e.g. backdrops larger than a cell
+	};
+
+	// Polyline of static collision, points live in LevelData::Points
+	struct LevelBarrier
+	{
+		uint FirstPoint = 0;
+		uint PointCount = 0;
+		float Thickness = 4.0f;
+		bool bClosed = false;
+	};
+
+	// Actor of a game-registered type, waypoints live in LevelData::Points
+	struct LevelActor
+	{
+		vec2f Position{};
+		uint FirstWaypoint = 0;
+		uint WaypointCount = 0;
+		LevelString Type = NoString;
+		LevelString Name = NoString;
+		bool bPersistent = false;			// Never streamed out, e.g. patrolling NPCs or quest items
+	};
+
+	struct LevelSpawn
+	{
+		vec2f Position{};
+		LevelString Name = NoString;
+	};
+
+	// In-memory level description. Authored as JSON and cooked to a flat binary
+	// whose record arrays are read back with one copy each.
+	// The records are raw struct bytes, so a cooked file is tied to the byte order and struct
+	// layout of the build that cooked it. The header stores the record sizes and readers
+	// reject a file whose layout differs, the same as an older version
+	struct LevelData
+	{
+		static constexpr uint Magic = 0x564C4557; // "WELV"
+		static constexpr uint16 Version = 3;
+
+		vector<string> Strings;
+		vector<LevelProp> Props;
+		vector<LevelBarrier> Barriers;
+		vector<LevelActor> Actors;
+		vector<LevelSpawn> Spawns;
+		vector<vec2f> Points;
+
+		const string& GetString(LevelString Index) const;
+
+		// Parses the authored text format; returns nullopt and logs on malformed input
+		static optional<LevelData> FromJson(const string& Text);
+
+		string ToBinary() const;
+
+		// True when Bytes start with the magic, version and record layout this build reads
+		static bool IsCurrentBinary(const string& Bytes);
+		static optional<LevelData> FromBinary(const string& Bytes);
+	};
+}
@@ -0,0 +1,55 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/Actor.h"
+
+class b2Body;
+
+namespace we
+{
+	// All static collision of a level on a single body. Shapes are queued before
+	// BeginPlay and created in one pass instead of one body per prop or barrier
+	class LevelGeometry : public Actor
+	{
+	public:
+		explicit LevelGeometry(World& InWorld);
+		~LevelGeometry();
+
+		void Reserve(ulong Circles, ulong Segments);
+
+		// Collides like a static PhysicsComponent circle
+		void AddCircle(vec2f Center, float Radius);
+
+		// Collides like a Barrier
+		void AddPolyline(const vec2f* Points, ulong Count, bool bClosed, float Thickness);
+
+		void BeginPlay() override;
+		void EndPlay() override;
+
+		ulong GetShapeCount() const { return Circles.size() + Segments.size(); }
+
+	private:
+		struct Circle
+		{
+			vec2f Center;
+			float Radius;
+		};
+
+		struct Segment
+		{
+			vec2f A;
+			vec2f B;
+			float Thickness;
+		};
+
+	private:
+		vector<Circle> Circles;
+		vector<Segment> Segments;
+		b2Body* Body = nullptr;
+	};
+}
@@ -0,0 +1,112 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/LevelData.h"
+#include "Framework/World/World.h"
+#include "Interface/World/IStreamingSource.h"
+
+#include <atomic>
+#include <functional>
+
+namespace we
+{
+	// What a level file knows about an actor of a game-registered type
+	struct LevelActorSpawn
+	{
+		string Name;
+		vec2f Position;
+		vector<vec2f> Waypoints;
+	};
+
+	// Instantiates level files into a world. Props, barriers and spawn points are handled
+	// by the engine; other actors are spawned through factories the game registers by type name
+	class LevelLoader : public IStreamingSource
+	{
+	public:
+		using ActorFactory = std::function<shared<Actor>(World&, const LevelActorSpawn&)>;
+
+		void RegisterActorType(const string& Type, ActorFactory Factory);
+
+		// Spawns the actor and places it; anything else it needs from the spawn data goes in a custom factory
+		template<typename ActorType>
+		void RegisterActorType(const string& Type);
+
+		// Path names the cooked .welv file. Raw asset builds cook the .json of that name into the
+		// build tree when it is newer, packed builds fall back to the .json if the cooked file is
+		// missing or was cooked for another layout
+		bool Load(World& InWorld, const string& Path);
+
+		// Like Load, but prop sprites and non-persistent actors are bucketed into world partition
+		// cells and streamed around the camera; collision stays loaded. The loader must outlive the world's play
+		bool LoadStreamed(World& InWorld, const string& Path);
+
+		// IStreamingSource
+		bool PrefetchCell(int64 Cell) override;
+		void LoadCell(int64 Cell, vector<weak<Actor>>& OutActors) override;
+		void UnloadCell(int64 Cell) override;
+
+		optional<vec2f> FindSpawnPoint(const string& Name) const;
+		shared<Actor> FindActor(const string& Name) const;
+
+		// Cooks authored level text into the binary format, used by LevelCook and raw asset builds
+		static bool Cook(const string& SourcePath, const string& CookedPath);
+
+	private:
+		struct CellContent
+		{
+			vector<uint> Props;
+			vector<uint> Actors;
+
+			// Held while the cell is prefetched or loaded, so its textures can be collected once it leaves
+			vector<shared<texture>> Textures;
+		};
+
+		// An image decoding on a job worker, picked up by the next prefetch that needs it
+		struct ImageDecode
+		{
+			shared<image> Decoded;
+			std::atomic<bool> bDone = false;
+		};
+
+	private:
+		static optional<LevelData> ReadLevel(const string& Path);
+
+		// Barriers, spawn points and, unless streaming, everything else
+		void Instantiate(World& InWorld, bool bStreamed);
+		void ResolveTexture(LevelString Index);
+		bool RequireTexture(LevelString Index, CellContent& Content);
+		void SpawnProp(const LevelProp& Prop, vector<weak<Actor>>* OutActors);
+		shared<Actor> SpawnLevelActor(const LevelActor& Placed);
+
+	private:
+		World* LoadedWorld = nullptr;
+		LevelData Level;
+
+		// Indexed by level string. Persistent props own theirs for the whole play, streamed
+		// cells own theirs in CellContent, so a texture nobody is near can be collected
+		vector<weak<texture>> Textures;
+		vector<shared<texture>> PersistentTextures;
+		dictionary<int64, CellContent> CellContents;
+		dictionary<LevelString, shared<ImageDecode>> Decoding;
+
+		dictionary<string, ActorFactory> Factories;
+		dictionary<string, vec2f> SpawnPoints;
+		dictionary<string, weak<Actor>> NamedActors;
+	};
+
+	template<typename ActorType>
+	inline void LevelLoader::RegisterActorType(const string& Type)
+	{
+		RegisterActorType(Type, [](World& InWorld, const LevelActorSpawn& Spawn) -> shared<Actor>
+		{
+			auto Spawned = InWorld.SpawnActor<ActorType>().lock();
+			Spawned->SetPosition(Spawn.Position);
+			return Spawned;
+		});
+	}
+}
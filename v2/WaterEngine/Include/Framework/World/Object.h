@@ -22,6 +22,8 @@ namespace we
 		weak<const Object> GetObject() const;
 
 	protected:
+		// Called once, when Destroy first marks the object
+		virtual void OnPendingDestroy() {}
 
 	private:
 		bool bIsPendingDestroy;
@@ -0,0 +1,62 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+	class Actor;
+
+	struct SignificanceStats
+	{
+		uint FullRate = 0;		// Ticked this frame because they are in view or always relevant
+		uint Throttled = 0;		// Ticked this frame with accumulated time
+		uint Deferred = 0;		// Due, but over the per-frame budget
+		uint Skipped = 0;		// Not due yet
+	};
+
+	// Scores actors by distance to the camera view each frame. Actors out of view tick
+	// at the interval of their distance tier with the time accumulated since their last tick
+	class SignificanceManager
+	{
+	public:
+		void BeginFrame(const rectf& InViewBounds);
+
+		// True when InActor ticks now at full rate. Out-of-view actors that are due are
+		// queued for RunThrottledTicks instead
+		bool Evaluate(Actor& InActor, float DeltaTime, float& OutDeltaTime);
+
+		// Ticks queued actors, most overdue first, up to WEConfig.World.MaxThrottledTicksPerFrame
+		template<typename Func>
+		void RunThrottledTicks(Func&& Tick);
+
+		const SignificanceStats& GetStats() const { return Stats; }
+
+	private:
+		// Orders the queue and returns how many of its actors tick this frame
+		ulong PrepareThrottledTicks();
+
+		float GetTickInterval(float Distance) const;
+		float GetDistanceToView(vec2f Position) const;
+
+	private:
+		rectf ViewBounds;
+		vector<pair<Actor*, float>> Due;
+		SignificanceStats Stats;
+	};
+
+	template<typename Func>
+	inline void SignificanceManager::RunThrottledTicks(Func&& Tick)
+	{
+		const ulong Count = PrepareThrottledTicks();
+		for (ulong i = 0; i < Count; ++i)
+		{
+			Tick(*Due[i].first, Due[i].second);
+		}
+		Due.clear();
+	}
+}
@@ -0,0 +1,223 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/Object.h"
+#include "Subsystem/ResourceSubsystem.h"
+
+#include <coroutine>
+#include <type_traits>
+
+namespace we
+{
+	class TaskScheduler;
+
+	// Gameplay coroutine. Any function returning GameTask can co_await WaitSeconds, WaitFrames,
+	// WaitUntil and WaitForAsset, and runs once handed to a world's TaskScheduler.
+	// Frames come from a pooled arena, so tasks are game-thread only
+	class GameTask
+	{
+	public:
+		struct promise_type
+		{
+			TaskScheduler* Scheduler = nullptr;
+			uint Slot = 0;
+
+			GameTask get_return_object() { return GameTask{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+
+			// The scheduler starts the task and destroys it once finished
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+
+			void return_void() {}
+			void unhandled_exception();
+
+			static void* operator new(ulong Size);
+			static void operator delete(void* Memory, ulong Size);
+		};
+
+		using Handle = std::coroutine_handle<promise_type>;
+
+		GameTask(GameTask&& Other) noexcept : Coroutine{ std::exchange(Other.Coroutine, {}) } {}
+		GameTask& operator=(GameTask&& Other) noexcept;
+		GameTask(const GameTask&) = delete;
+		GameTask& operator=(const GameTask&) = delete;
+
+		// Tasks never started are destroyed here; started ones belong to the scheduler
+		~GameTask();
+
+	private:
+		friend class TaskScheduler;
+
+		explicit GameTask(Handle InCoroutine) : Coroutine{ InCoroutine } {}
+
+	private:
+		Handle Coroutine;
+	};
+
+	// Refers to a started task. Goes stale once the task finishes or is cancelled
+	struct TaskHandle
+	{
+		uint Slot = 0;
+		uint Generation = 0;
+	};
+
+	// Resumes the tasks of one world from its tick. Sleeping tasks sit in wake-time heaps and
+	// cost nothing until due; only WaitUntil conditions are tested every frame. A task whose
+	// owner has been destroyed is dropped instead of resumed
+	class TaskScheduler
+	{
+	public:
+		TaskScheduler() = default;
+		~TaskScheduler();
+
+		TaskScheduler(const TaskScheduler&) = delete;
+		TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+		// Runs the task up to its first wait right away
+		TaskHandle Start(weak<Object> Owner, GameTask Task);
+		void Cancel(TaskHandle Handle);
+		bool IsRunning(TaskHandle Handle) const;
+
+		// Called by the world each tick, so tasks pause with it
+		void Tick(float DeltaTime);
+
+		ulong GetTaskCount() const { return LiveCount; }
+
+		// Used by the awaitables
+		void SleepFor(uint Slot, float Seconds);
+		void SleepFrames(uint Slot, uint Frames);
+		void PollUntil(uint Slot, void* Context, bool (*Test)(void*));
+		void LoadFor(uint Slot, void* Context, void (*Load)(void*));
+
+	private:
+		struct TaskSlot
+		{
+			GameTask::Handle Coroutine;
+			weak<Object> Owner;
+			uint Generation = 1;
+			bool bRunning = false;
+			bool bCancelled = false;
+		};
+
+		struct TimedWake
+		{
+			double Time = 0.0;
+			uint Slot = 0;
+			uint Generation = 0;
+		};
+
+		struct FrameWake
+		{
+			ulong Frame = 0;
+			uint Slot = 0;
+			uint Generation = 0;
+		};
+
+		// Context points at the awaiter, which lives in the suspended frame
+		struct PollWait
+		{
+			uint Slot = 0;
+			uint Generation = 0;
+			void* Context = nullptr;
+			bool (*Test)(void*) = nullptr;
+		};
+
+		struct LoadWait
+		{
+			uint Slot = 0;
+			uint Generation = 0;
+			void* Context = nullptr;
+			void (*Load)(void*) = nullptr;
+		};
+
+	private:
+		void Resume(uint Slot, uint Generation);
+		void Release(uint Slot);
+		bool IsCurrent(uint Slot, uint Generation) const;
+		bool HasLiveOwner(uint Slot) const;
+
+	private:
+		vector<TaskSlot> Slots;
+		vector<uint> FreeSlots;
+		ulong LiveCount = 0;
+
+		double Time = 0.0;
+		ulong Frame = 0;
+
+		vector<TimedWake> Sleeping;
+		vector<FrameWake> FrameSleeping;
+		vector<PollWait> Polling;
+		vector<LoadWait> AssetLoads;
+		ulong NextAssetLoad = 0;
+		vector<pair<uint, uint>> Ready;
+	};
+
+	// co_await WaitSeconds(2.0f): resumes once that much world time has passed
+	struct WaitSeconds
+	{
+		float Seconds = 0.0f;
+
+		explicit WaitSeconds(float InSeconds) : Seconds{ InSeconds } {}
+
+		bool await_ready() const noexcept { return Seconds <= 0.0f; }
+		void await_suspend(GameTask::Handle Coroutine) const { Coroutine.promise().Scheduler->SleepFor(Coroutine.promise().Slot, Seconds); }
+		void await_resume() const noexcept {}
+	};
+
+	// co_await WaitFrames(1): resumes on a later world tick
+	struct WaitFrames
+	{
+		uint Frames = 1;
+
+		explicit WaitFrames(uint InFrames = 1) : Frames{ InFrames } {}
+
+		bool await_ready() const noexcept { return Frames == 0; }
+		void await_suspend(GameTask::Handle Coroutine) const { Coroutine.promise().Scheduler->SleepFrames(Coroutine.promise().Slot, Frames); }
+		void await_resume() const noexcept {}
+	};
+
+	// co_await WaitUntil([this] { return bDoorOpen; }): tested once per tick until true
+	template<typename Predicate>
+	struct WaitUntil
+	{
+		Predicate Condition;
+
+		explicit WaitUntil(Predicate InCondition) : Condition{ std::move(InCondition) } {}
+
+		bool await_ready() { return Condition(); }
+		void await_suspend(GameTask::Handle Coroutine) { Coroutine.promise().Scheduler->PollUntil(Coroutine.promise().Slot, this, &Test); }
+		void await_resume() const noexcept {}
+
+		static bool Test(void* Self) { return static_cast<WaitUntil*>(Self)->Condition(); }
+	};
+
+	// auto Tex = co_await WaitForAsset<texture>("..."): loads on a later tick within
+	// WEConfig.World.TaskAssetBudgetMs, so a burst of loads is spread over frames
+	template<typename AssetType>
+	struct WaitForAsset
+	{
+		string Path;
+		shared<AssetType> Asset;
+
+		explicit WaitForAsset(string InPath) : Path{ std::move(InPath) } {}
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(GameTask::Handle Coroutine) { Coroutine.promise().Scheduler->LoadFor(Coroutine.promise().Slot, this, &Load); }
+		shared<AssetType> await_resume() { return std::move(Asset); }
+
+		static void Load(void* Self)
+		{
+			auto& Wait = *static_cast<WaitForAsset*>(Self);
+			if constexpr (std::is_same_v<AssetType, texture>) Wait.Asset = LoadAsset().LoadTexture(Wait.Path);
+			else if constexpr (std::is_same_v<AssetType, soundBuffer>) Wait.Asset = LoadAsset().LoadSound(Wait.Path);
+			else if constexpr (std::is_same_v<AssetType, font>) Wait.Asset = LoadAsset().LoadFont(Wait.Path);
+			else if constexpr (std::is_same_v<AssetType, music>) Wait.Asset = LoadAsset().LoadMusic(Wait.Path);
+			else static_assert(!sizeof(AssetType), "WaitForAsset supports texture, soundBuffer, font and music");
+		}
+	};
+}
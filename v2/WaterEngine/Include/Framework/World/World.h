@@ -8,11 +8,20 @@
 #include "Core/CoreMinimal.h"
 #include "Framework/World/Object.h"
 #include "Framework/World/Actor.h"
+#include "Framework/World/WorldSnapshot.h"
+#include "Framework/World/WorldPartition.h"
+#include "Framework/World/SignificanceManager.h"
+#include "Framework/World/ComponentRegistry.h"
+#include "Framework/World/CrowdAvoidance.h"
+#include "Framework/World/TaskScheduler.h"
+#include "Framework/World/EventBus.h"
 #include "Subsystem/WorldSubsystem.h"
+#include "Audio/SoundBank.h"
 
 namespace we
 {
 	class PhysicsSubsystem;
+	class NavigationSubsystem;
 	class CameraSubsystem;
 	class SaveSubsystem;
 	class GameInstance;
@@ -31,6 +40,9 @@ namespace we
 		template<typename ActorType, typename... Args>
 		weak<ActorType> SpawnActor(Args&&... args);
 
+		// Grows actor storage up front before spawning many actors at once, e.g. on level load
+		void ReserveActors(ulong Count);
+
 		template<typename Func>
 		void OrderActorDrawables(Func&& Callback);
 
@@ -41,12 +53,61 @@ namespace we
 		
 		// Actor lookup by ID
 		Actor* FindActor(ActorID ID) const;
+
+		// Visits every actor that has begun play, is not pending destroy and is a T, which may be an
+		// interface. Actors are stored in contiguous lists per concrete type, so only matching lists are walked
+		template<typename T, typename Func>
+		void ForEachActorOfType(Func&& Callback);
+
+		template<typename TagType, typename Func>
+		void ForEachActorWithTag(TagType Tag, Func&& Callback);
+
+		// Includes actors pending destroy until they are collected
+		template<typename TagType>
+		const vector<Actor*>& GetActorsWithTag(TagType Tag) const { return ActorsByTag[static_cast<uint>(Tag)]; }
 		
 		PhysicsSubsystem& GetPhysics() { return Subsystem.GetPhysics(); }
+		NavigationSubsystem& GetNavigation() { return Subsystem.GetNavigation(); }
 		CameraSubsystem& GetCamera() { return Subsystem.GetCamera(); }
 		SaveSubsystem& GetSave() { return Subsystem.GetSave(); }
 		GameInstance& GetGameInstance() { return Subsystem.GetGameInstance(); }
 
+		// Packs every snapshot-enabled actor into a binary blob for checkpoints and quick restart
+		WorldSnapshot CaptureSnapshot() const;
+
+		// Rewinds snapshot-enabled actors in place and recreates their physics bodies in one pass.
+		// Opted-in actors spawned after the capture are destroyed. Ones destroyed since are spawned
+		// again when their type was spawned without arguments, and load their state before BeginPlay
+		bool RestoreSnapshot(const WorldSnapshot& Snapshot);
+
+		// Streams partition cells around the camera each tick once enabled
+		WorldPartition& GetPartition() { return Partition; }
+
+		// Decides each tick which actors update at full rate and which are throttled
+		const SignificanceManager& GetSignificance() const { return Significance; }
+
+		// Pooled actor components, ticked type by type after every actor has ticked
+		ComponentRegistry& GetComponents() { return Components; }
+
+		// Local avoidance between moving agents, resolved after the components tick
+		CrowdAvoidance& GetCrowd() { return Crowd; }
+
+		// Gameplay coroutines, resumed each tick before actors tick
+		TaskScheduler& GetTasks() { return Tasks; }
+
+		// Deferred notifications, delivered at the start of each tick and again after the world ticks
+		EventBus& GetEvents() { return Events; }
+
+		// IDs of static actors added, changed or destroyed since the last call, for the static layer cache
+		void TakeStaticChanges(vector<ActorID>& OutChanged);
+
+		// Incremented at the start of every StartTick
+		ulong GetFrameNumber() const { return FrameNumber; }
+
+		// Decodes the level's sound effects up front; they stay cached while this world lives
+		void LoadSoundBank(vector<string> Sounds, bool bCompact = false);
+		const SoundBank& GetSoundBank() const { return Sounds; }
+
 	protected:
 		WorldSubsystem& Subsystem;
 
@@ -58,22 +119,95 @@ namespace we
 	private:
 		void RegisterActor(ActorID ID, shared<Actor> Actor);
 		void UnregisterActor(ActorID ID);
+
+		// Called by actors whose tags change after they were registered
+		friend class Actor;
+		void UpdateTagIndex(Actor& Tagged, uint Tag, bool bAdded);
+		void QueueStaticChange(ActorID ID);
 		
 	private:
 		bool bHasBegunPlay;
+		ulong FrameNumber;
+
+		// Declared before the actor lists so it outlives every component owner
+		ComponentRegistry Components;
 		vector<shared<Actor>> PendingActors;
+
+		// Rebuild destroyed snapshot actors, by concrete type. Respawns maps the ID an actor had at
+		// capture to the ID of its latest replacement, so one checkpoint can be restored many times
+		dictionary<TypeID, std::function<shared<Actor>()>> SnapshotFactories;
+		dictionary<ActorID, ActorID> SnapshotRespawns;
 		vector<shared<Actor>> Actors;
 		dictionary<ActorID, shared<Actor>> ActorByID;
+		vector<vector<Actor*>> ActorsByType;
+		vector<ActorID> StaticChanges;
+		array<vector<Actor*>, MAX_ACTOR_TAGS> ActorsByTag;
+		SoundBank Sounds;
+		WorldPartition Partition;
+		SignificanceManager Significance;
+		CrowdAvoidance Crowd;
+		EventBus Events;
+
+		// Declared after the actor lists, so task frames are destroyed while their owners still exist
+		TaskScheduler Tasks;
 	};
 
 	template<typename ActorType, typename... Args>
 	inline weak<ActorType> World::SpawnActor(Args&&... args)
 	{
 		auto NewActor = make_shared<ActorType>(*this, std::forward<Args>(args)...);
+		NewActor->ConcreteType = GetTypeID<ActorType>();
+
+		// Snapshot actors opt in from their constructor, so the type is known to be rebuildable now
+		if constexpr (sizeof...(Args) == 0)
+		{
+			if (NewActor->IsSnapshotEnabled() && !SnapshotFactories.contains(NewActor->ConcreteType))
+			{
+				SnapshotFactories.emplace(NewActor->ConcreteType, [this]() -> shared<Actor>
+				{
+					return SpawnActor<ActorType>().lock();
+				});
+			}
+		}
+
 		PendingActors.push_back(NewActor);
 		return NewActor;
 	}
 
+	template<typename T, typename Func>
+	inline void World::ForEachActorOfType(Func&& Callback)
+	{
+		for (ulong Type = INVALID_TYPE_ID + 1; Type < ActorsByType.size(); ++Type)
+		{
+			// Every actor in a list shares its concrete type, so one check covers the whole list
+			const auto& TypeList = ActorsByType[Type];
+			if (TypeList.empty() || !TypeList.front()->IsA<T>()) continue;
+
+			for (ulong i = 0; i < TypeList.size(); ++i)
+			{
+				Actor* Found = TypeList[i];
+				if (!Found->IsPendingDestroy())
+				{
+					Callback(*Found->Cast<T>());
+				}
+			}
+		}
+	}
+
+	template<typename TagType, typename Func>
+	inline void World::ForEachActorWithTag(TagType Tag, Func&& Callback)
+	{
+		const auto& TagList = ActorsByTag[static_cast<uint>(Tag)];
+		for (ulong i = 0; i < TagList.size(); ++i)
+		{
+			Actor* Found = TagList[i];
+			if (!Found->IsPendingDestroy())
+			{
+				Callback(*Found);
+			}
+		}
+	}
+
 	template<typename Func>
 	inline void World::OrderActorDrawables(Func&& Callback)
 	{
@@ -0,0 +1,71 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Interface/World/IStreamingSource.h"
+
+namespace we
+{
+	class Actor;
+
+	// Streams grid cells of a level in and out around a focus point, usually the camera.
+	// Work is queued and drained under WEConfig.World.StreamingBudgetMs per frame
+	class WorldPartition
+	{
+	public:
+		using CellKey = int64;
+
+		// Cells lists every cell the source has content for; the rest of the grid is ignored
+		void Enable(IStreamingSource& InSource, const vector<CellKey>& InCells);
+
+		// Forgets all cells without destroying their actors, e.g. when the world ends
+		void Reset();
+
+		bool IsEnabled() const { return Source != nullptr; }
+
+		void Update(vec2f Focus);
+
+		static CellKey GetCellKey(vec2f Position);
+		static rectf GetCellRect(CellKey Key);
+
+		ulong GetCellCount() const { return Cells.size(); }
+		ulong GetLoadedCellCount() const { return LoadedCount; }
+		ulong GetPendingCount() const { return LoadQueue.size() + UnloadQueue.size(); }
+
+	private:
+		enum class ECellState : uint8
+		{
+			Unloaded,
+			Queued,
+			Prefetched,
+			Loaded
+		};
+
+		struct Cell
+		{
+			ECellState State = ECellState::Unloaded;
+			vector<weak<Actor>> Actors;
+		};
+
+	private:
+		void QueueCells(vec2f Focus);
+		void ProcessQueues();
+		void UnloadCell(CellKey Key);
+
+		static float GetDistanceToCell(vec2f Focus, CellKey Key);
+
+	private:
+		IStreamingSource* Source = nullptr;
+		dictionary<CellKey, Cell> Cells;
+
+		// Cells that are queued, prefetched or loaded
+		set<CellKey> ActiveCells;
+		vector<CellKey> LoadQueue;
+		vector<CellKey> UnloadQueue;
+		ulong LoadedCount = 0;
+	};
+}
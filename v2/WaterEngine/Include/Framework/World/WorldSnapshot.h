@@ -0,0 +1,90 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace we
+{
+	// Appends raw values to a snapshot blob
+	class SnapshotWriter
+	{
+	public:
+		explicit SnapshotWriter(vector<uint8>& InBuffer) : Buffer{InBuffer} {}
+
+		template<typename T>
+		void Write(const T& Value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const ulong Offset = Buffer.size();
+			Buffer.resize(Offset + sizeof(T));
+			std::memcpy(Buffer.data() + Offset, &Value, sizeof(T));
+		}
+
+		ulong GetSize() const { return Buffer.size(); }
+
+	private:
+		vector<uint8>& Buffer;
+	};
+
+	// Reads values back in the order they were written. Reads past the end leave
+	// the value untouched and mark the reader as failed
+	class SnapshotReader
+	{
+	public:
+		SnapshotReader(const uint8* InData, ulong InSize) : Data{InData}, Size{InSize} {}
+
+		template<typename T>
+		bool Read(T& OutValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			if (bFailed || Offset + sizeof(T) > Size)
+			{
+				bFailed = true;
+				return false;
+			}
+			std::memcpy(&OutValue, Data + Offset, sizeof(T));
+			Offset += sizeof(T);
+			return true;
+		}
+
+		// Splits off the next Bytes as their own reader and skips past them
+		optional<SnapshotReader> ReadBlock(ulong Bytes)
+		{
+			if (bFailed || Offset + Bytes > Size)
+			{
+				bFailed = true;
+				return std::nullopt;
+			}
+			SnapshotReader Block(Data + Offset, Bytes);
+			Offset += Bytes;
+			return Block;
+		}
+
+		bool IsValid() const { return !bFailed; }
+		bool IsAtEnd() const { return Offset == Size; }
+
+	private:
+		const uint8* Data;
+		ulong Size;
+		ulong Offset = 0;
+		bool bFailed = false;
+	};
+
+	// State of every snapshot-enabled actor in a world, packed as
+	// [ActorID][TypeID][payload size][payload] per actor. Cheap to copy and restore any number of times
+	struct WorldSnapshot
+	{
+		vector<uint8> Data;
+		uint ActorCount = 0;
+
+		bool IsEmpty() const { return ActorCount == 0; }
+		ulong GetMemoryUsage() const { return Data.size(); }
+	};
+}
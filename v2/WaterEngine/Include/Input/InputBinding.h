@@ -37,6 +37,24 @@ namespace we
         optional<int> LogicToHardware(GamepadButton Button, int HardwareID);
         optional<GamepadButton> HardwareToLogic(int Button, int HardwareID);
 
+        // Packs the fields compared by operator== into one integer, used to index bindings
+        // Layout: [alternative:8][device id:24][button/key/axis:32]
+        inline uint64_t GetBindingKey(const Binding& InBinding)
+        {
+            auto Pack = [&InBinding](uint64_t DeviceID, uint64_t Code) -> uint64_t {
+                return (static_cast<uint64_t>(InBinding.index()) << 56) | ((DeviceID & 0xFFFFFF) << 32) | (Code & 0xFFFFFFFF);
+            };
+
+            return std::visit([&Pack](const auto& x) -> uint64_t {
+                using T = std::decay_t<decltype(x)>;
+                if constexpr (std::is_same_v<T, Keyboard>) return Pack(0, static_cast<uint64_t>(x.Key));
+                else if constexpr (std::is_same_v<T, Mouse>) return Pack(0, static_cast<uint64_t>(x.Button));
+                else if constexpr (std::is_same_v<T, Gamepad>) return Pack(static_cast<uint64_t>(x.GamepadID), static_cast<uint64_t>(x.Button));
+                else if constexpr (std::is_same_v<T, JoystickAxis>) return Pack(static_cast<uint64_t>(x.AxisID), static_cast<uint64_t>(x.Axis));
+                else return Pack(0, static_cast<uint64_t>(x.Direction));
+                }, InBinding);
+        }
+
         inline bool BindingsEqual(const Binding& A, const Binding& B)
         {
             return std::visit([](const auto& x, const auto& y) -> bool {
@@ -0,0 +1,41 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Input/InputBinding.h"
+
+namespace we
+{
+    enum class EInputEventType : uint8
+    {
+        Pressed,
+        Released,
+        Cleared     // Every held input dropped, e.g. on focus loss
+    };
+
+    struct InputEventRecord
+    {
+        uint64_t Frame = 0;     // Relative to the recording start inside an InputRecording
+        float Time = 0.0f;      // Seconds since the input subsystem was created
+        EInputEventType Type = EInputEventType::Pressed;
+        Input::Binding Binding;
+    };
+
+    // Input events plus the frame delta stream and RNG seed needed to reproduce a session
+    struct InputRecording
+    {
+        static constexpr uint Magic = 0x52494557; // "WEIR"
+        static constexpr uint16 Version = 1;
+
+        uint Seed = 0;
+        vector<float> DeltaTimes;           // One entry per recorded frame
+        vector<InputEventRecord> Events;    // Ordered by frame
+
+        bool SaveToFile(const string& Path) const;
+        bool LoadFromFile(const string& Path);
+    };
+}
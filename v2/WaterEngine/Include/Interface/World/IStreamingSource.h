@@ -0,0 +1,29 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+	class Actor;
+
+	// Provides the content of world partition cells
+	class IStreamingSource
+	{
+	public:
+		virtual ~IStreamingSource() = default;
+
+		// Makes the assets a cell needs resident; runs as its own budgeted step before LoadCell.
+		// Returns false while work is still in flight, and the partition asks again next frame
+		virtual bool PrefetchCell(int64 Cell) = 0;
+
+		// Spawns the cell's actors. The partition destroys them when the cell streams out
+		virtual void LoadCell(int64 Cell, vector<weak<Actor>>& OutActors) = 0;
+
+		// The cell streamed out or left range before it loaded; release what it held
+		virtual void UnloadCell(int64 Cell) = 0;
+	};
+}
@@ -0,0 +1,42 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Navigation/NavGrid.h"
+
+namespace we
+{
+	using FlowFieldID = uint;
+	inline constexpr FlowFieldID INVALID_FLOW_FIELD = 0;
+
+	// Direction toward one goal for every cell of a grid, so any number of agents heading
+	// to it share one search. Built on a worker, then only read until it is rebuilt
+	class NavFlowField
+	{
+	public:
+		// Dijkstra outward from GoalCell. Reuses the storage of the previous build
+		void Build(shared<const NavGrid> InGrid, vec2i InGoalCell);
+
+		bool IsValid() const { return Grid != nullptr; }
+		const NavGrid* GetGrid() const { return Grid.get(); }
+		vec2i GetGoalCell() const { return GoalCell; }
+
+		// Unit step toward the next cell on the way to the goal. Zero in the goal cell and
+		// where the goal cannot be reached; cells inside inflated obstacles lead back out
+		vec2f GetDirection(vec2f Position) const;
+
+		// Path length to the goal in cells, if it can be reached from Cell
+		optional<float> GetCost(vec2i Cell) const;
+
+	private:
+		shared<const NavGrid> Grid;
+		vec2i GoalCell;
+		vector<float> Costs;
+		vector<uint8> Directions;
+		vector<pair<float, uint>> Open;
+	};
+}
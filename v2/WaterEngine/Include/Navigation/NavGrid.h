@@ -0,0 +1,81 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+	// Static collision shape copied out of Box2D on the game thread, in pixels
+	struct NavObstacle
+	{
+		enum class EType : uint8
+		{
+			Circle,		// Points[0] is the center
+			Segment,	// Points[0] to Points[1]
+			Polygon		// Convex, counter-clockwise like Box2D
+		};
+
+		EType Type = EType::Circle;
+		array<vec2f, 8> Points{};
+		uint8 PointCount = 0;
+		float Radius = 0.0f;		// Circle radius, or the skin Box2D keeps around edges and polygons
+	};
+
+	struct NavPath
+	{
+		// Waypoints after the start; the last one is the goal
+		vector<vec2f> Points;
+		bool bFound = false;
+	};
+
+	// Walkability grid baked from static collision inflated by the agent radius.
+	// Published grids are never modified, so workers can search one while the next is baked
+	class NavGrid
+	{
+	public:
+		NavGrid() = default;
+		NavGrid(const rectf& InBounds, float InCellSize);
+
+		// Clears the cells of Region and blocks the ones within AgentRadius of an obstacle
+		void Rasterize(const vector<NavObstacle>& Obstacles, const rectf& Region, float AgentRadius);
+
+		bool IsValid() const { return Width > 0 && Height > 0; }
+		vec2i GetSize() const { return { Width, Height }; }
+		float GetCellSize() const { return CellSize; }
+		rectf GetBounds() const { return rectf(Origin, { Width * CellSize, Height * CellSize }); }
+		ulong GetCellCount() const { return Blocked.size(); }
+		ulong GetBlockedCount() const;
+
+		bool IsInside(vec2i Cell) const { return Cell.x >= 0 && Cell.y >= 0 && Cell.x < Width && Cell.y < Height; }
+		bool IsWalkable(vec2i Cell) const { return IsInside(Cell) && !Blocked[GetIndex(Cell)]; }
+
+		vec2i WorldToCell(vec2f Position) const;
+		vec2f CellToWorld(vec2i Cell) const;
+		uint GetIndex(vec2i Cell) const { return static_cast<uint>(Cell.y * Width + Cell.x); }
+		vec2i GetCell(uint Index) const { return { static_cast<int>(Index % Width), static_cast<int>(Index / Width) }; }
+
+		// Nearest walkable cell within MaxRadius rings, for starts and goals inside inflated obstacles
+		optional<vec2i> FindNearestWalkable(vec2i Cell, int MaxRadius) const;
+
+		// True when the straight line between two cell centers only crosses walkable cells
+		bool HasLineOfSight(vec2i From, vec2i To) const;
+
+		// A* over 8-connected cells with an octile heuristic. Diagonal steps never cut corners.
+		// Safe to call from several threads at once
+		bool FindPath(vec2i Start, vec2i Goal, uint MaxExpanded, vector<vec2i>& OutCells) const;
+
+		// Drops every cell the previous kept cell can see past, leaving only the turns
+		void SmoothPath(vector<vec2i>& InOutCells) const;
+
+	private:
+		vec2f Origin;
+		float CellSize = 32.0f;
+		int Width = 0;
+		int Height = 0;
+		vector<uint8> Blocked;
+	};
+}
@@ -0,0 +1,35 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+namespace we
+{
+    // Premultiplied alpha, for content that was already blended into a render texture
+    inline const sf::BlendMode BlendPremultiplied{sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha};
+
+    // Sprite that carries its own blend mode through the draw list
+    class BlendedSprite : public drawable
+    {
+    public:
+        BlendedSprite(const texture& Texture, const sf::BlendMode& InBlend)
+            : Sprite{Texture}
+            , Blend{InBlend}
+        {
+        }
+
+        sprite Sprite;
+        sf::BlendMode Blend;
+
+    private:
+        void draw(renderTarget& Target, sf::RenderStates States) const override
+        {
+            States.blendMode = Blend;
+            Target.draw(Sprite, States);
+        }
+    };
+}
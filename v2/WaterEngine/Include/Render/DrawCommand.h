@@ -0,0 +1,62 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Subsystem/RenderSubsystem.h"
+
+namespace we
+{
+    // Plain copy of a draw, independent of the actor that produced it
+    struct DrawCommand
+    {
+        enum class EKind : uint8
+        {
+            Sprite,
+            Vertices
+        };
+
+        EKind Kind = EKind::Sprite;
+        const texture* Texture = nullptr;
+        recti TextureRect;
+        sf::Transform Transform;
+        color Tint = color::White;
+        sf::BlendMode Blend = sf::BlendAlpha;
+        ERenderLayer Layer = ERenderLayer::World;
+        float Depth = 0.0f;
+
+        // Vertices, in local space under Transform
+        sf::PrimitiveType Primitive = sf::PrimitiveType::Triangles;
+        vector<sf::Vertex> Vertices;
+
+        // Sprites and blended sprites, plus shapes (fill only) and vertex arrays the same way
+        // RenderCapture records them. Other drawables return nullopt
+        static optional<DrawCommand> FromDrawable(const drawable& Drawable, ERenderLayer Layer, float Depth);
+
+        void Submit(RenderSubsystem& Render) const;
+    };
+
+    // Everything the render thread needs to present one frame
+    struct RenderFrame
+    {
+        vec2f WorldViewCenter;
+        float WorldViewZoom = 1.0f;
+        float WorldViewRotation = 0.0f;
+        view WindowView;
+
+        // Sorted back to front
+        vector<DrawCommand> Commands;
+
+        // Keeps actor-owned textures alive until the frame has been presented
+        vector<shared<texture>> RetainedTextures;
+
+        void Reset()
+        {
+            Commands.clear();
+            RetainedTextures.clear();
+        }
+    };
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Subsystem/RenderSubsystem.h"
+
+namespace we
+{
+    enum class ECaptureKind : uint8
+    {
+        Sprite,
+        Vertices
+    };
+
+    enum class ECaptureBlend : uint8
+    {
+        Alpha,
+        Add,
+        Multiply,
+        None,
+        Premultiplied
+    };
+
+    struct CapturedTexture
+    {
+        vec2u Size;
+        string Name;    // Resource name, empty for runtime textures
+    };
+
+    struct CapturedCommand
+    {
+        ECaptureKind Kind = ECaptureKind::Sprite;
+        ERenderLayer Layer = ERenderLayer::World;
+        ECaptureBlend Blend = ECaptureBlend::Alpha;
+        sf::PrimitiveType Primitive = sf::PrimitiveType::Triangles;
+        uint TextureID = NoTexture;
+        array<float, 6> Transform{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+
+        // Sprite
+        recti TextureRect;
+        color Tint = color::White;
+
+        // Vertices
+        vector<sf::Vertex> Vertices;
+
+        static constexpr uint NoTexture = 0xFFFFFFFF;
+
+        sf::Transform GetTransform() const;
+        sf::BlendMode GetBlendMode() const;
+    };
+
+    struct CapturedFrame
+    {
+        vec2f WorldViewCenter;
+        vec2f WorldViewSize;
+        float WorldViewRotation = 0.0f;
+        rectf WorldViewport;
+        vector<CapturedCommand> Commands;
+    };
+
+    // Compact binary recording of RenderSubsystem draws
+    struct RenderCapture
+    {
+        static constexpr uint Magic = 0x43524557; // "WERC"
+        static constexpr uint16 Version = 1;
+
+        vec2u Resolution;
+        vector<CapturedTexture> Textures;
+        vector<CapturedFrame> Frames;
+
+        bool SaveToFile(const string& Path) const;
+        bool LoadFromFile(const string& Path);
+    };
+
+    // Records every RenderSubsystem::Draw for a fixed number of frames
+    class RenderCaptureRecorder
+    {
+    public:
+        void Start(const string& Path, uint FrameCount, vec2u Resolution);
+        bool IsActive() const { return FramesRemaining > 0; }
+
+        void BeginFrame(const view& WorldView);
+
+        // Updates the open frame's view; ignored between EndFrame and the next BeginFrame
+        void SetWorldView(const view& WorldView);
+        void Record(const drawable& Drawable, ERenderLayer Layer, const sf::RenderStates& States);
+        void EndFrame();
+
+    private:
+        uint GetTextureID(const texture* Texture);
+
+    private:
+        RenderCapture Capture;
+        string OutputPath;
+        uint FramesRemaining = 0;
+        uint SkippedDraws = 0;
+        bool bFrameOpen = false;
+        dictionary<const texture*, uint> TextureIDs;
+    };
+}
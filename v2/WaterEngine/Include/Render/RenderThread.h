@@ -0,0 +1,56 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Render/DrawCommand.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace we
+{
+    class RenderSubsystem;
+    class WindowSubsystem;
+
+    // Owns the window's GL context and presents frames built on the game thread
+    class RenderThread
+    {
+    public:
+        RenderThread(RenderSubsystem& InRender, WindowSubsystem& InWindow);
+        ~RenderThread();
+
+        void Start();
+        void Stop();
+        bool IsRunning() const { return Thread.joinable(); }
+
+        // Game thread fills the back frame while the front one is being presented
+        RenderFrame& GetBackFrame() { return Frames[BackIndex]; }
+        void Submit();
+
+        // Blocks until the render thread has finished every submitted frame
+        void WaitIdle();
+
+    private:
+        void Run();
+        void Execute(const RenderFrame& Frame);
+
+    private:
+        RenderSubsystem& Render;
+        WindowSubsystem& Window;
+
+        std::thread Thread;
+        std::mutex Mutex;
+        std::condition_variable Condition;
+
+        array<RenderFrame, 2> Frames;
+        uint BackIndex = 0;
+        optional<uint> PendingIndex;
+        bool bBusy = false;
+        bool bStopRequested = false;
+    };
+}
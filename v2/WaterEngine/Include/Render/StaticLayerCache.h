@@ -0,0 +1,70 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Render/BlendedSprite.h"
+
+namespace we
+{
+    class World;
+
+    // Pre-renders static actors into world-space tiles, split into depth bands so
+    // dynamic actors still sort between them
+    class StaticLayerCache
+    {
+    public:
+        // Re-renders the tiles of static actors the world reports as added, changed or destroyed.
+        // Unchanged actors are never visited
+        void Update(World& InWorld);
+
+        // Appends the band sprites overlapping ViewBounds together with their sort depth
+        void CollectVisible(const rectf& ViewBounds, vector<pair<const drawable*, float>>& OutDrawables) const;
+
+        void Clear();
+        ulong GetBandCount() const;
+
+    private:
+        using TileKey = int64;
+
+        struct ActorEntry
+        {
+            vector<TileKey> Tiles;
+        };
+
+        struct Band
+        {
+            float Depth = 0.0f;
+            rectf Bounds;
+            unique<renderTexture> Target;
+            unique<BlendedSprite> Drawable;
+        };
+
+        struct Tile
+        {
+            // Ordered by band index, i.e. back to front
+            map<int, Band> Bands;
+        };
+
+    private:
+        void RebuildTile(const World& InWorld, TileKey Key);
+        vector<TileKey> GetCoveredTiles(const vector<const drawable*>& Drawables) const;
+
+        static TileKey MakeKey(int X, int Y);
+        static rectf GetTileRect(TileKey Key);
+        static optional<rectf> GetBounds(const drawable& Drawable);
+
+    private:
+        dictionary<TileKey, Tile> Tiles;
+        dictionary<ActorID, ActorEntry> Entries;
+
+        // Actors overlapping each tile, the inverse of ActorEntry::Tiles, so a rebuild only visits its own
+        dictionary<TileKey, vector<ActorID>> TileActors;
+
+        // Reused each update for the world's change list
+        vector<ActorID> Changed;
+    };
+}
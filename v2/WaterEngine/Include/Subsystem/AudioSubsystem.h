@@ -6,6 +6,11 @@
 #pragma once
 
 #include "Core/CoreMinimal.h"
+#include "Utility/SPSCQueue.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace we
 {
@@ -16,21 +21,53 @@ namespace we
         Master, Music, Ambient, SFX, Voice, UI, ChannelSize
     };
 
+    // A full voice pool only steals voices of equal or lower priority
+    enum class SoundPriority : uint8
+    {
+        Low, Normal, High, Critical
+    };
+
+    struct AudioVoiceStats
+    {
+        uint PoolSize = 0;
+        uint ActiveVoices = 0;
+        uint PeakVoices = 0;
+        ulong Played = 0;
+        ulong Stolen = 0;       // Voices cut short for a new sound
+        ulong Rejected = 0;     // Requests dropped because every voice had higher priority
+        ulong Merged = 0;       // Repeat triggers of a sound within the same frame
+        ulong Culled = 0;       // Positional sounds beyond the audible radius
+    };
+
+    // Public calls are made from the game thread and posted as commands; the mixer
+    // state they drive is owned by the audio thread (or by Update when it is disabled)
     class AudioSubsystem
     {
     public:
         AudioSubsystem();
+        ~AudioSubsystem();
 
         static AudioSubsystem& Get();
 
+        // Runs commands and fades here only when the audio thread is disabled
         void Update(float DeltaTime);
 
         void PlayMusic(const string& Path, float FadeInDuration = 0.0f);
         void PlayAmbient(const string& Path, float FadeInDuration = 0.0f);
         void CrossfadeMusic(const string& Path, float Duration);
         void CrossfadeAmbient(const string& Path, float Duration);
-        void PlaySFX(const string& Path);
-        void PlayVoice(const string& Path);
+        void PlaySFX(const string& Path, SoundPriority Priority = SoundPriority::Normal);
+        void PlayVoice(const string& Path, SoundPriority Priority = SoundPriority::High);
+
+        // Attenuated and panned relative to the listener, dropped outright beyond the audible radius
+        void PlaySFXAt(const string& Path, vec2f WorldPosition, SoundPriority Priority = SoundPriority::Normal);
+
+        // Call once per frame with the camera view position
+        void SetListenerPosition(vec2f Position);
+        vec2f GetListenerPosition() const { return ListenerPosition; }
+
+        // Caps simultaneous instances of one sound, 0 restores the configured default
+        void SetSoundConcurrency(const string& Path, uint MaxInstances);
 
         void StopMusic(float FadeDuration = 0.0f);
         void StopAmbient(float FadeDuration = 0.0f);
@@ -52,10 +89,14 @@ namespace we
         void SetPaused(bool bPaused);
         bool IsPaused() const;
 
+        // Playback state as of the last audio update, so a sound started this frame may not show yet
         bool IsMusicPlaying() const;
         bool IsAmbientPlaying() const;
         ulong GetActiveSFXCount() const;
         ulong GetActiveVoiceCount() const;
+        AudioVoiceStats GetVoiceStats() const;
+
+        bool IsAudioThreadRunning() const { return AudioThread.joinable(); }
 
     private:
         struct MusicTrack
@@ -67,32 +108,133 @@ namespace we
             bool bFadingIn = false;
         };
 
-        struct SFXInstance
+        // Sounds are created lazily on first use and reused with a new buffer afterwards
+        struct PooledVoice
         {
+            optional<sound> Sound;
             shared<soundBuffer> Buffer;
-            unique<sound> Sound;
+            AudioChannel Channel = AudioChannel::SFX;
+            SoundPriority Priority = SoundPriority::Normal;
+            ulong StartOrder = 0;
+            vec2f Position;
+            Volume PositionGain = 1.0f;
+            bool bPositional = false;
+            bool bActive = false;
         };
 
+        struct MixSettings
+        {
+            Volume MasterVolume = 1.0f;
+            array<Volume, static_cast<ulong>(AudioChannel::ChannelSize)> ChannelVolumes;
+            array<bool, static_cast<ulong>(AudioChannel::ChannelSize)> ChannelMuted;
+            bool bMasterMuted = false;
+            bool bPaused = false;
+        };
+
+        enum class AudioCommandType : uint8
+        {
+            PlayMusic, PlayAmbient, CrossfadeMusic, CrossfadeAmbient, PlaySound,
+            StopMusic, StopAmbient, StopChannel, StopAll,
+            SetMasterVolume, SetChannelVolume, SetMasterMuted, SetChannelMuted, SetPaused, SetListener
+        };
+
+        // One sound started this frame, positional ones bucketed by TriggerMergeDistance
+        struct FrameTrigger
+        {
+            const soundBuffer* Buffer = nullptr;
+            optional<vec2i> Cell;
+
+            bool operator==(const FrameTrigger&) const = default;
+        };
+
+        // Assets are resolved on the game thread, the audio thread never touches the resource cache
+        struct AudioCommand
+        {
+            AudioCommandType Type = AudioCommandType::StopAll;
+            AudioChannel Channel = AudioChannel::Master;
+            SoundPriority Priority = SoundPriority::Normal;
+            float Value = 0.0f;
+            bool bFlag = false;
+            uint MaxInstances = 0;
+            optional<vec2f> Position;
+            shared<music> Music;
+            shared<soundBuffer> Buffer;
+        };
+
+        // Game thread
+        void Post(AudioCommand&& Command);
+        void PostSound(const string& Path, AudioChannel Channel, SoundPriority Priority, optional<vec2f> Position = std::nullopt);
+        uint GetSoundConcurrency(const string& Path) const;
+
+        // Audio thread
+        void RunAudioThread();
+        void ProcessCommands();
+        void Execute(AudioCommand& Command);
+        void Tick(float DeltaTime);
+        void PublishState();
+
+        void StartTrack(unique<MusicTrack>& Track, shared<music> Music, float FadeInDuration, AudioChannel Channel);
+        void CrossfadeTrack(unique<MusicTrack>& Track, unique<MusicTrack>& Fading, shared<music> Music, float Duration, AudioChannel Channel);
+        void StopTrack(unique<MusicTrack>& Track, float FadeDuration);
+        void StopAllTracks();
+        void ApplyVolumeToAll();
+        void ApplyPause();
+
+        void StartVoice(const AudioCommand& Command);
+        PooledVoice* AcquireVoice(const soundBuffer& Buffer, uint MaxInstances, SoundPriority Priority);
+        void ReleaseVoice(PooledVoice& Voice);
+        void StopVoices(AudioChannel Channel);
+        void ApplyVolumeToVoices(AudioChannel Channel);
+        void UpdateSpatialization(PooledVoice& Voice) const;
+        ulong CountActiveVoices(AudioChannel Channel) const;
+
         void UpdateFades(float DeltaTime);
         void CleanupStoppedSounds();
         void ApplyVolumeToMusic(MusicTrack& Track, AudioChannel Channel);
         Volume GetEffectiveVolume(AudioChannel Channel) const;
+        static bool IsTrackPlaying(const unique<MusicTrack>& Track);
 
     private:
         static AudioSubsystem* Instance;
+
+        // Game thread
+        MixSettings Settings;
+        dictionary<string, uint> SoundConcurrency;
+        vector<FrameTrigger> FrameTriggers;
+        ulong MergedTriggers = 0;
+        ulong CulledSounds = 0;
+        vec2f ListenerPosition;
+
+        SPSCQueue<AudioCommand> Commands;
+        std::thread AudioThread;
+        std::atomic<bool> bStopRequested{false};
+
+        // Audio thread
+        MixSettings Mix;
+        vec2f MixListenerPosition;
         unique<MusicTrack> CurrentMusic;
         unique<MusicTrack> CurrentAmbient;
         unique<MusicTrack> FadingMusic;
         unique<MusicTrack> FadingAmbient;
-        vector<SFXInstance> ActiveSFX;
-        vector<SFXInstance> ActiveVoice;
-
-        Volume MasterVolume = 1.0f;
-        array<Volume, static_cast<ulong>(AudioChannel::ChannelSize)> ChannelVolumes;
-        array<bool, static_cast<ulong>(AudioChannel::ChannelSize)> ChannelMuted;
-        bool bMasterMuted = false;
-        bool bPaused = false;
+
+        // Released voices are parked on this empty buffer, so the cache can free their last
+        // buffer on the game thread without touching a sound the audio thread owns.
+        // Declared before the pool so it outlives every sound attached to it
+        soundBuffer IdleBuffer;
+
+        // Sized once from the audio config and never reallocated
+        vector<PooledVoice> VoicePool;
+        ulong NextStartOrder = 0;
+        AudioVoiceStats Stats;
+
+        // Published by the audio thread after every update
+        std::atomic<bool> bMusicPlaying{false};
+        std::atomic<bool> bAmbientPlaying{false};
+        std::atomic<ulong> ActiveSFXCount{0};
+        std::atomic<ulong> ActiveVoiceCount{0};
+        mutable std::mutex StatsMutex;
+        AudioVoiceStats PublishedStats;
     };
 
     inline AudioSubsystem& PlayAudio() { return AudioSubsystem::Get(); }
-}
\ No newline at end of file
+}
@@ -16,6 +16,9 @@ namespace we
 		float GetDeltaTime() const;
 		float GetElapsedTime() const;
 
+		// Replaces this frame's delta, used to replay recorded sessions
+		void OverrideDeltaTime(float Seconds);
+
 		void SetPaused(bool bInPaused);
 		void Pause() { SetPaused(true); }
 		void Resume() { SetPaused(false); }
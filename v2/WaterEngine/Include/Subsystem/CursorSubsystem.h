@@ -17,7 +17,7 @@ namespace we
 
 		void SetTexture(shared<texture> Texture);
 
-		void SetVisibility(bool Visible) { bIsVisible = Visible; }
+		void SetVisibility(bool Visible);
 		bool IsVisible() const { return bIsVisible; }
 
 		void SetPosition(vec2f Position);
@@ -28,6 +28,9 @@ namespace we
 
 		const drawable* GetDrawable() const;
 
+		// True once after the cursor moved, changed texture or was shown or hidden
+		bool ConsumeChanges();
+
 	private:
 		shared<texture> CursorTexture;
 		optional<sprite> CursorSprite;
@@ -35,6 +38,7 @@ namespace we
 		vec2f CurrentPosition;
 		vec2f CursorSize;
 		bool bIsVisible;
+		bool bChanged;
 
 		static CursorSubsystem* Instance;
 	};
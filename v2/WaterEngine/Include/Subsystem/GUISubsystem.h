@@ -23,6 +23,16 @@ namespace we
 		tgui::Gui& GetScreenUI() { return ScreenUI; }
 		tgui::Gui& GetWorldUI() { return WorldUI; }
 
+		// False when the container has nothing visible to draw
+		bool IsScreenUIActive() const { return HasVisibleWidgets(ScreenUI); }
+		bool IsWorldUIActive() const { return HasVisibleWidgets(WorldUI); }
+
+		// True once after anything that changes how the container draws: input it was given,
+		// running animations and timers, or widgets shown, hidden, moved, resized, retexted or
+		// set to another value. Also advances the container's clock, so call it every frame
+		bool ConsumeScreenUIChanges() { return ConsumeChanges(ScreenUI, ScreenUIChanges); }
+		bool ConsumeWorldUIChanges() { return ConsumeChanges(WorldUI, WorldUIChanges); }
+
 		void SetWindowSize(vec2u NewSize);
 		void SetCameraView(const view& NewView);
 		void SetCameraWorldPosition(const vec2f& WorldPos);
@@ -39,11 +49,24 @@ namespace we
 		void RequestFullscreen(bool bEnabled);
 		Delegate<bool> OnFullscreenRequested;
 
+	private:
+		struct ChangeTracker
+		{
+			ulong Signature = 0;
+			bool bDirty = true;
+		};
+
 	private:
 		static GUISubsystem* Instance;
 
+		static bool HasVisibleWidgets(const tgui::Gui& Gui);
+		static bool ConsumeChanges(tgui::Gui& Gui, ChangeTracker& Tracker);
+		static void HashWidgets(const vector<tgui::Widget::Ptr>& Widgets, ulong& Seed);
+
 		tgui::Gui ScreenUI;
 		tgui::Gui WorldUI;
+		ChangeTracker ScreenUIChanges;
+		ChangeTracker WorldUIChanges;
 		
 		vec2u WindowSize;
 		view CurrentCameraView;
@@ -7,11 +7,13 @@
 
 #include "Core/CoreMinimal.h"
 #include "Input/InputBinding.h"
+#include "Input/InputRecording.h"
 #include <SFML/Window/Event.hpp>
 
 namespace we
 {
     class InputSubsystem;
+    class ClockSubsystem;
 
     // RAII handle for input bindings - auto-unbinds on destruction
     class BindingHandle
@@ -48,15 +50,38 @@ namespace we
 
         static InputSubsystem& Get();
 
+        // Actions are small non-negative ids (typically an enum), used to index dense state arrays
         void Bind(int InputAction, const Input::Binding& Binding);
+        void Unbind(int InputAction, const Input::Binding& Binding);
+
+        // Starts a new frame for the edge-triggered queries, call before polling events
+        void BeginFrame();
 
         bool Pressed(int InputAction) const;
+        bool PressedThisFrame(int InputAction) const;
+        bool ReleasedThisFrame(int InputAction) const;
+
         void OnPressed(const Input::Binding& Binding);
         void OnReleased(const Input::Binding& Binding);
         
         // Clear all held inputs (call when window loses focus)
         void ClearAllInput();
 
+        // Most recent input events, oldest first
+        vector<InputEventRecord> GetRecentEvents() const;
+
+        // Recording and replay both begin at the next BeginFrame so frame indices line up
+        // Start them where the world state is reproducible, e.g. right after a level load
+        void StartRecording();
+        bool StopRecording(const string& Path);
+        bool StartReplay(const string& Path);
+        void StopReplay();
+        bool IsRecording() const { return Mode == ESessionMode::Recording || Mode == ESessionMode::RecordPending; }
+        bool IsReplaying() const { return Mode == ESessionMode::Replaying || Mode == ESessionMode::ReplayPending; }
+
+        // Call after the clock ticks: records the frame delta, or replaces it with the recorded one
+        void SyncClock(ClockSubsystem& Clock);
+
         // Event-driven binding with RAII handle - using member function
         template<typename ClassType>
         BindingHandle BindAction(int InputAction, ClassType* Object, void(ClassType::* Method)())
@@ -73,14 +98,60 @@ namespace we
         // Non-template implementation
         BindingHandle BindAction(int InputAction, std::function<void()> Callback);
 
+        struct ActionState
+        {
+            uint HeldCount = 0;
+            uint64_t PressedFrame = 0;
+            uint64_t ReleasedFrame = 0;
+
+            // Token-based callback storage for event-driven input, token 0 marks one released mid-dispatch
+            vector<pair<uint64_t, std::function<void()>>> Callbacks;
+        };
+
+        struct AddedCallback
+        {
+            int Action = -1;
+            uint64_t Token = 0;
+            std::function<void()> Callback;
+        };
+
+        enum class ESessionMode : uint8
+        {
+            Live, RecordPending, Recording, ReplayPending, Replaying
+        };
+
+        ActionState& GetState(int InputAction);
+        const ActionState* FindState(int InputAction) const;
+        void RecordEvent(EInputEventType Type, const Input::Binding& Binding);
+        void DispatchReplayFrame();
+        void ApplyCallbackChanges();
+
         static InputSubsystem* Instance;
-        library<int, Input::Binding> Bindings;
-        set<int> HeldActions;
-        dictionary<int, uint> ActionPressCount;
 
-        // Token-based callback storage for event-driven input
-        dictionary<int, dictionary<uint64_t, std::function<void()>>> ActionCallbacks;
+        // Binding key to every action it drives, see Input::GetBindingKey
+        dictionary<uint64_t, vector<int>> BindingIndex;
+        vector<ActionState> Actions;
+        uint64_t FrameIndex = 1;
         uint64_t NextToken = 1;
+
+        // Reused by every press. Callbacks may press again, so each call only touches the entries it pushed
+        vector<int> Triggered;
+
+        // Callbacks run in place, so binds and releases made by one wait until the outermost press returns
+        uint DispatchDepth = 0;
+        vector<AddedCallback> AddedCallbacks;
+        bool bHasReleasedCallbacks = false;
+
+        // Ring buffer of recent events
+        vector<InputEventRecord> History;
+        ulong HistoryHead = 0;
+        ulong HistoryCount = 0;
+        clock SessionClock;
+
+        ESessionMode Mode = ESessionMode::Live;
+        InputRecording Session;
+        uint64_t SessionStartFrame = 0;
+        ulong ReplayCursor = 0;
     };
 
     inline InputSubsystem& InputController() { return InputSubsystem::Get(); }
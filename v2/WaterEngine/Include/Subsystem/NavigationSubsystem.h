@@ -0,0 +1,153 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Framework/World/Object.h"
+#include "Navigation/NavGrid.h"
+#include "Navigation/FlowField.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace we
+{
+	class PhysicsSubsystem;
+
+	using NavRequestID = uint;
+	inline constexpr NavRequestID INVALID_NAV_REQUEST = 0;
+
+	// Bakes a walkability grid from static Box2D collision and answers path queries and
+	// builds flow fields on the shared job workers. Everything public is game-thread only; results arrive in Tick
+	class NavigationSubsystem
+	{
+	public:
+		using PathCallback = std::function<void(const NavPath&)>;
+
+		explicit NavigationSubsystem(PhysicsSubsystem& InPhysics);
+
+		// Starts queued bakes, publishes finished ones and runs path callbacks.
+		// Call after the physics step so bodies created or destroyed this frame are settled
+		void Tick();
+
+		// Bakes every static body on the next Tick, once a newly loaded level has created them
+		void RequestBake();
+
+		// Forgets the grid, cached paths and pending callbacks, e.g. when the world changes
+		void Reset();
+
+		// Immutable; a newer bake replaces the pointer rather than changing the grid
+		shared<const NavGrid> GetGrid() const { return Grid; }
+		bool HasGrid() const { return Grid != nullptr; }
+
+		// Searches on a job worker. OnComplete runs in a later Tick while Owner is alive.
+		// Requests between the same cells share one search and the cached result
+		NavRequestID FindPath(weak<Object> Owner, vec2f Start, vec2f Goal, PathCallback OnComplete);
+		void CancelPath(NavRequestID ID);
+
+		ulong GetCachedPathCount() const { return PathCache.size(); }
+		ulong GetPendingPathCount() const { return Requests.size(); }
+
+		// Leads any number of agents to one goal, e.g. the player or an exit. Rebuilt on a worker
+		// when the goal enters another cell or the grid is rebaked; until then agents read the last one
+		FlowFieldID CreateFlowField(vec2f Goal);
+		void SetFlowFieldGoal(FlowFieldID ID, vec2f Goal);
+		void DestroyFlowField(FlowFieldID ID);
+
+		// Unit direction to walk from Position, or zero at the goal, where it cannot be reached
+		// or before the first build. Cheap enough to call for every agent every frame
+		vec2f GetFlowDirection(FlowFieldID ID, vec2f Position) const;
+
+		ulong GetFlowFieldCount() const { return FlowFields.size(); }
+
+	private:
+		struct PathRequest
+		{
+			weak<Object> Owner;
+			PathCallback OnComplete;
+			vec2f Start;
+			vec2f Goal;
+			bool bExactGoal = false;
+		};
+
+		struct PathResult
+		{
+			int64 Key = 0;
+			uint GridVersion = 0;
+			uint Epoch = 0;
+			shared<const NavPath> Path;
+		};
+
+		struct FlowFieldState
+		{
+			// Agents read Buffers[Front] while a worker fills the other one
+			array<shared<NavFlowField>, 2> Buffers;
+			uint8 Front = 0;
+			vec2f Goal;
+			optional<vec2i> BuiltGoalCell;
+			uint BuiltGridVersion = 0;
+			bool bBuilding = false;
+		};
+
+		struct FlowFieldResult
+		{
+			FlowFieldID ID = INVALID_FLOW_FIELD;
+			uint Epoch = 0;
+		};
+
+		struct BakeResult
+		{
+			shared<const NavGrid> Grid;
+			uint Epoch = 0;
+			float Milliseconds = 0.0f;
+		};
+
+		// Where jobs leave their results. Jobs hold this rather than the subsystem, so one that
+		// finishes after the subsystem is gone still writes into live memory
+		struct Mailbox
+		{
+			std::mutex Mutex;
+			vector<PathResult> Paths;
+			vector<FlowFieldResult> Fields;
+			vector<BakeResult> Bakes;
+		};
+
+	private:
+		void StartBake();
+		void CollectObstacles(const rectf& Region, vector<NavObstacle>& OutObstacles) const;
+
+		void Dispatch(NavRequestID ID);
+		void Deliver(NavRequestID ID, const NavPath& Path);
+		void CachePath(int64 Key, shared<const NavPath> Path);
+
+		void UpdateFlowField(FlowFieldID ID, FlowFieldState& Field);
+
+	private:
+		PhysicsSubsystem& Physics;
+
+		// Game thread
+		shared<const NavGrid> Grid;
+		uint GridVersion = 0;
+		uint Epoch = 0;
+		bool bFullBakePending = false;
+		bool bBakeInFlight = false;
+
+		NavRequestID NextRequestID = 1;
+		dictionary<NavRequestID, PathRequest> Requests;
+		vector<NavRequestID> WaitingForGrid;
+		vector<pair<NavRequestID, shared<const NavPath>>> ReadyPaths;
+		dictionary<int64, vector<NavRequestID>> InFlight;
+		dictionary<int64, shared<const NavPath>> PathCache;
+		std::deque<int64> CacheOrder;
+
+		FlowFieldID NextFlowFieldID = 1;
+		dictionary<FlowFieldID, FlowFieldState> FlowFields;
+
+		// Shared with jobs
+		shared<Mailbox> Finished;
+	};
+}
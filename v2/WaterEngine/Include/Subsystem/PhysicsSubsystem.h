@@ -13,11 +13,13 @@ class b2Body;
 struct b2BodyDef;
 struct b2Vec2;
 class b2Contact;
+class b2Fixture;
 class b2ContactListener;
 
 namespace we
 {
 	class World;
+	class PhysicsComponent;
 }
 
 namespace we
@@ -39,6 +41,21 @@ namespace we
 		void DestroyBody(b2Body* Body);
 		void MarkForDestruction(b2Body* Body);
 
+		// Bulk body recreation for snapshot restores. All old bodies are destroyed before
+		// any new one is created, so restored actors never collide with stale bodies
+		void QueueBodyRebuild(PhysicsComponent* Component);
+		void RebuildQueuedBodies();
+
+		// Bodies whose owning actor follows them. Velocities they were given are applied in
+		// one pass before each step, and awake bodies write their actor's position after it
+		void RegisterSyncedBody(PhysicsComponent* Component);
+		void UnregisterSyncedBody(PhysicsComponent* Component);
+
+		// Static collision for navigation baking, in pixels. Sensors and bodies waiting
+		// for destruction are skipped
+		void QueryStaticFixtures(const rectf& Region, const std::function<void(const b2Fixture&)>& Visit) const;
+		optional<rectf> GetStaticBounds() const;
+
 		// Contact listener registration
 		void RegisterContactListener(b2Body* Body, ActorID ID);
 		void UnregisterContactListener(b2Body* Body);
@@ -61,6 +78,8 @@ namespace we
 	private:
 		void ProcessPendingDestruction();
 		void ProcessContactEvents();
+		void ApplyPendingVelocities();
+		void SyncActorsToBodies();
 
 	private:
 		unique<b2World> PhysicsWorld;
@@ -70,6 +89,8 @@ namespace we
 		int PositionIterations;
 
 		set<b2Body*> PendingDestruction;
+		vector<PhysicsComponent*> PendingRebuilds;
+		vector<PhysicsComponent*> SyncedBodies;
 		dictionary<b2Body*, ActorID> ContactListeners;
 		World* CurrentWorld = nullptr;
 		bool bInPhysicsStep = false;
@@ -15,17 +15,30 @@ namespace we
         World,
         WorldUI,
         ScreenUI,
-        Cursor
+        Cursor,
+        Count
     };
 
+    class RenderCaptureRecorder;
+
     class RenderSubsystem
     {
     public:
         explicit RenderSubsystem();
+        ~RenderSubsystem();
 
         void BeginFrame();
+        void BeginLayer(ERenderLayer Layer);
         void Draw(const drawable& RenderObject, ERenderLayer Layer);
+        void Draw(const drawable& RenderObject, ERenderLayer Layer, const sf::RenderStates& States);
+        void EndLayer(ERenderLayer Layer);
         void EndFrame();
+
+        // Retained layers keep their last drawn content until invalidated
+        void SetLayerRetained(ERenderLayer Layer, bool bRetained);
+        void InvalidateLayer(ERenderLayer Layer);
+        bool NeedsRedraw(ERenderLayer Layer) const;
+        uint GetLayerDrawCount(ERenderLayer Layer) const;
         
         // Camera view setup
         void SetWorldView(vec2f Center, float Zoom = 1.0f, float Rotation = 0.0f);
@@ -33,8 +46,19 @@ namespace we
         sprite GetCompositeSprite() const;
         vec2u GetRenderResolution() const { return RenderResolution; }
 
+        // Dynamic resolution
+        float GetWorldResolutionScale() const { return WorldResolutionScale; }
+        float GetSmoothedFrameTime() const { return SmoothedFrameTime; }
+
+        // Holds the world at a fixed scale, e.g. so replay timings compare across runs.
+        // nullopt hands the scale back to dynamic resolution
+        void PinWorldResolutionScale(optional<float> Scale);
+
         void SetTargetSize(vec2u Size);
 
+        // Records the next FrameCount frames of draws; starts on the next BeginFrame
+        void RequestCapture(const string& Path, uint FrameCount);
+
         // GUI render target access
         renderTarget& GetWorldUITarget() { return WorldUIRenderTarget; }
         renderTarget& GetScreenUITarget() { return ScreenUIRenderTarget; }
@@ -52,12 +76,43 @@ namespace we
         renderTexture CompositePostProcessTarget;
         vector<unique<IPostProcess>> CompositePostProcessEffects;
 
+        // Per-layer dirty tracking
+        struct LayerState
+        {
+            renderTexture* Target = nullptr;
+            color ClearColor = color::Transparent;
+            uint DrawCount = 0;
+            bool bDrawnThisFrame = false;
+            bool bDisplayed = false;
+            bool bHasContent = false;
+            bool bRetained = false;
+            bool bInvalidated = true;
+        };
+        array<LayerState, static_cast<ulong>(ERenderLayer::Count)> Layers;
+
         vec2u RenderResolution;
         bool bNeedsComposite;
 
+        // World targets are allocated at the max scale and rendered into a sub-rect
+        vec2u WorldTargetSize;
+        float WorldResolutionScale;
+        optional<float> PinnedResolutionScale;
+        float SmoothedFrameTime;
+        clock FrameTimer;
+        clock ScaleAdjustTimer;
+        clock OnTargetTimer;
+
+        unique<RenderCaptureRecorder> Recorder;
+        optional<pair<string, uint>> PendingCapture;
+
     private:
+        LayerState& GetLayer(ERenderLayer Layer) { return Layers[static_cast<ulong>(Layer)]; }
+        const LayerState& GetLayer(ERenderLayer Layer) const { return Layers[static_cast<ulong>(Layer)]; }
+
         void CreateRenderTargets();
-        void ClearRenderTargets();
+        void ResolveLayers();
+        void UpdateDynamicResolution(float FrameTime);
+        vec2u GetScaledWorldSize() const;
         void PostProcess(renderTexture* Input, renderTexture* Output, vector<unique<IPostProcess>>& Effects);
         void ApplyPostProcess(renderTexture& MainTarget, renderTexture& PostProcessTarget, vector<unique<IPostProcess>>& Effects);
         void CompositeLayers();
@@ -23,8 +23,25 @@ namespace we
         shared<font>        LoadFont(const string& Filename);
         shared<music>       LoadMusic(const string& Filename);
 
+        // Reads and decodes an image without touching the caches. Safe to call from worker threads
+        shared<image>       DecodeImage(const string& Filename);
+
+        // Uploads an image from DecodeImage and caches the texture as LoadTexture would
+        shared<texture>     LoadTexture(const string& Filename, const image& Decoded);
+
+        // Decodes every uncached sound on the shared job workers, see SoundBank
+        // Compact stores short sounds as mono, halving stereo memory
+        vector<shared<soundBuffer>> PreloadSounds(const vector<string>& Filenames, bool bCompact = false);
+
+        // Decoded PCM bytes of all cached sounds
+        ulong GetSoundMemoryUsage() const;
+        static ulong GetSoundMemory(const soundBuffer& Buffer);
+
         void GarbageCollect();
 
+        // Reverse lookup of a cached texture, empty if not loaded through this subsystem
+        string FindTextureName(const texture* Texture) const;
+
         #ifdef USE_PACKED_ASSETS
         // Public for UIStyle font loading from packed assets
         string LoadFileData(const string& Path);
@@ -36,13 +53,18 @@ namespace we
 
         string ResolvePath(const string& Filename);
 
+        // Safe to call from worker threads
+        static shared<soundBuffer> DecodeSound(const string& Path, bool bCompact);
+
     private:
         static ResourceSubsystem* Instance;
         
         dictionary<string, shared<texture>>     Textures;
         dictionary<string, shared<soundBuffer>> Sounds;
         dictionary<string, shared<font>>        Fonts;
-        dictionary<string, shared<music>>       Music;
+
+        // Held weakly: the audio thread drops a track when it stops, and its stream closes right then
+        dictionary<string, weak<music>>         Music;
         dictionary<string, string>              Data;
     };
 
@@ -8,6 +8,10 @@
 #include "Core/CoreMinimal.h"
 #include "Core/JsonTypes.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace we
 {
 	class SaveSubsystem
@@ -22,17 +26,37 @@ namespace we
 		template <typename T>
 		T Get(stringView Key, const T& DefaultValue = T{}) const;
 
+		// Snapshots the data and writes it on a background thread
+		// Saves issued while one is being written collapse into the latest
 		void Save();
+
+		// Blocks until every requested save is on disk
+		void Flush();
+
 		bool Has(stringView Key) const;
 		void Erase(stringView Key);
 		void Clear();
 
 	private:
 		string GetSavePath() const;
+		void RunWriter();
+
+		static vector<uint8> Encode(const json& Data);
+		static json Decode(const vector<uint8>& Bytes);
+
+		// Writes a temp file, syncs it to disk and renames it over Path
+		static bool WriteFileAtomic(const string& Path, const vector<uint8>& Bytes);
 
 	private:
 		json SaveData;
 		string SavePath;
+
+		std::thread Writer;
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		optional<json> PendingSnapshot;
+		bool bWriting = false;
+		bool bStopRequested = false;
 	};
 
 	template <typename T>
@@ -20,6 +20,8 @@ namespace we
         void HandleEvent(const event& Event);
         void SetIcon(const string& Path);
 
+        void CloseWindow();
+
         void ToggleFullscreen();
         void SetFullscreen(bool bEnabled);
         bool IsFullscreen() const { return bFullscreen; }
@@ -28,6 +30,10 @@ namespace we
         Delegate<vec2u> OnResize;
         Delegate<vec2f> OnMouseMove;
 
+        // Fired around context destruction so a render thread can release it
+        Delegate<> OnBeforeClose;
+        Delegate<> OnRecreated;
+
     private:
         friend WindowEventHandler;
 
@@ -11,19 +11,27 @@ namespace we
 {
     class World;
     class PhysicsSubsystem;
+    class NavigationSubsystem;
     class CameraSubsystem;
     class SaveSubsystem;
     class GameInstance;
+    class StaticLayerCache;
     
     using we::shared;
 
     class WorldSubsystem
     {
     public:
+        WorldSubsystem();
+        ~WorldSubsystem();
+
         void Tick(float DeltaTime);
 
         void SetPhysicsRef(shared<PhysicsSubsystem> InPhysics);
         PhysicsSubsystem& GetPhysics();
+
+        void SetNavigationRef(shared<NavigationSubsystem> InNavigation);
+        NavigationSubsystem& GetNavigation();
         
         void SetCameraRef(shared<CameraSubsystem> InCamera);
         CameraSubsystem& GetCamera();
@@ -36,7 +44,10 @@ namespace we
 
         shared<World> GetCurrentWorld() const { return CurrentWorld; }
         bool HasPendingWorld() const { return PendingWorld != nullptr; }
-        vector<const drawable*>& GetOrderedDrawables() const;
+        vector<const drawable*>& GetOrderedDrawables(vector<float>* OutDepths = nullptr) const;
+
+        // Each distinct actor sprite texture once
+        void CollectSpriteTextures(vector<shared<texture>>& OutTextures) const;
         
         template<typename WorldType>
         void CreateWorld();
@@ -51,11 +62,15 @@ namespace we
         void Quit() { bShouldQuit = true; }
         bool ShouldQuit() const { return bShouldQuit; }
 
+        // World-space square that covers the camera view at any rotation
+        rectf GetCameraCullBounds() const;
+
     private:
         void GarbageCollect(float DeltaTime);
 
     private:
         weak<PhysicsSubsystem> Physics;
+        weak<NavigationSubsystem> Navigation;
         weak<CameraSubsystem> Camera;
         weak<SaveSubsystem> Save;
         weak<GameInstance> GameInst;
@@ -63,6 +78,12 @@ namespace we
         shared<World> CurrentWorld;
         shared<World> PendingWorld;
 
+        // Only created when RenderConfig::bStaticLayerCache is set
+        unique<StaticLayerCache> StaticCache;
+
+        // Reused by CollectSpriteTextures so the per-frame dedupe doesn't allocate
+        mutable set<const texture*> CollectedTextures;
+
         float GCTimer = 0.0f;
         static constexpr float GCInterval = 3.0f;
         
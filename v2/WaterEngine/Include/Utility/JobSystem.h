@@ -0,0 +1,51 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace we
+{
+    // Worker threads started once and shared by engine systems, so splitting work across
+    // cores doesn't pay for creating threads every time
+    class JobSystem
+    {
+    public:
+        static JobSystem& Get();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // Runs Job on a worker some time later
+        void Enqueue(std::function<void()> Job);
+
+        // Calls Body(Begin, End) over [0, Count) in chunks of ChunkSize and returns once all of them ran.
+        // The calling thread takes chunks too, so this finishes even while every worker is busy
+        void ParallelFor(ulong Count, ulong ChunkSize, const std::function<void(ulong, ulong)>& Body);
+
+        uint GetWorkerCount() const { return static_cast<uint>(Workers.size()); }
+
+    private:
+        JobSystem();
+        ~JobSystem();
+
+        void RunWorker();
+
+    private:
+        vector<std::thread> Workers;
+        std::mutex Mutex;
+        std::condition_variable Condition;
+        std::deque<std::function<void()>> Jobs;
+        bool bStopRequested = false;
+    };
+
+    inline JobSystem& GetJobs() { return JobSystem::Get(); }
+}
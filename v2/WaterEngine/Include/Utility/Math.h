@@ -255,8 +255,18 @@ namespace we
             return static_cast<T>(Random(static_cast<float>(Min), static_cast<float>(Max)));
         }
 
+        // Reseeding makes every following draw reproducible, used by input replay
+        void SetSeed(uint InSeed)
+        {
+            Seed = InSeed;
+            RandomEngine.seed(InSeed);
+        }
+
+        uint GetSeed() const { return Seed; }
+
     private:
-        std::mt19937 RandomEngine = std::mt19937{ std::random_device{}() };
+        uint Seed = std::random_device{}();
+        std::mt19937 RandomEngine = std::mt19937{ Seed };
     };
 
     inline RandomGenerator& RNG() { return RandomGenerator::Get(); }
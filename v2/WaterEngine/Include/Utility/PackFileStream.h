@@ -0,0 +1,40 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#ifdef USE_PACKED_ASSETS
+
+#include "Core/CoreMinimal.h"
+
+#include <physfs.h>
+
+namespace we
+{
+    // Reads a file from the mounted asset pack on demand, so streamed assets
+    // never need the whole file in memory
+    class PackFileStream : public sf::InputStream
+    {
+    public:
+        PackFileStream() = default;
+        ~PackFileStream() override;
+
+        PackFileStream(const PackFileStream&) = delete;
+        PackFileStream& operator=(const PackFileStream&) = delete;
+
+        bool Open(const string& Path);
+        void Close();
+
+        optional<std::size_t> read(void* Data, std::size_t Size) override;
+        optional<std::size_t> seek(std::size_t Position) override;
+        optional<std::size_t> tell() override;
+        optional<std::size_t> getSize() override;
+
+    private:
+        PHYSFS_File* File = nullptr;
+    };
+}
+
+#endif // USE_PACKED_ASSETS
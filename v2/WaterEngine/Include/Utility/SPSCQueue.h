@@ -0,0 +1,69 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+
+#include <atomic>
+#include <bit>
+
+namespace we
+{
+    // Bounded lock-free queue for exactly one producer thread and one consumer thread
+    template<typename T>
+    class SPSCQueue
+    {
+    public:
+        // Capacity is rounded up to a power of two
+        explicit SPSCQueue(ulong InCapacity)
+            : Slots(std::bit_ceil(InCapacity < 2 ? 2 : InCapacity))
+            , Mask{Slots.size() - 1}
+        {
+        }
+
+        SPSCQueue(const SPSCQueue&) = delete;
+        SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+        // Producer only. Leaves Item untouched and returns false when full
+        bool Push(T&& Item)
+        {
+            const ulong Write = WriteIndex.load(std::memory_order_relaxed);
+            if (Write - ReadIndex.load(std::memory_order_acquire) == Slots.size())
+                return false;
+
+            Slots[Write & Mask] = std::move(Item);
+            WriteIndex.store(Write + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only
+        bool Pop(T& OutItem)
+        {
+            const ulong Read = ReadIndex.load(std::memory_order_relaxed);
+            if (Read == WriteIndex.load(std::memory_order_acquire))
+                return false;
+
+            OutItem = std::move(Slots[Read & Mask]);
+            ReadIndex.store(Read + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool IsEmpty() const
+        {
+            return ReadIndex.load(std::memory_order_acquire) == WriteIndex.load(std::memory_order_acquire);
+        }
+
+        ulong GetCapacity() const { return Slots.size(); }
+
+    private:
+        vector<T> Slots;
+        const ulong Mask;
+
+        // Kept on separate cache lines so the two threads don't contend
+        alignas(64) std::atomic<ulong> WriteIndex{0};
+        alignas(64) std::atomic<ulong> ReadIndex{0};
+    };
+}
@@ -0,0 +1,36 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Audio/SoundBank.h"
+#include "Subsystem/ResourceSubsystem.h"
+
+namespace we
+{
+    SoundBank::SoundBank(vector<string> InSounds, bool bInCompact)
+        : Sounds{std::move(InSounds)}
+        , bCompact{bInCompact}
+    {
+    }
+
+    void SoundBank::Load()
+    {
+        Buffers = LoadAsset().PreloadSounds(Sounds, bCompact);
+    }
+
+    void SoundBank::Unload()
+    {
+        Buffers.clear();
+    }
+
+    ulong SoundBank::GetMemoryUsage() const
+    {
+        ulong Bytes = 0;
+        for (const auto& Buffer : Buffers)
+        {
+            Bytes += ResourceSubsystem::GetSoundMemory(*Buffer);
+        }
+        return Bytes;
+    }
+}
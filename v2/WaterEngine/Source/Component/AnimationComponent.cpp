@@ -30,6 +30,9 @@ namespace we
     {
         if (!CurrentState.has_value() || !Owner) return;
 
+        // Nobody can see the frame change, so culled actors hold their pose
+        if (!Owner->IsInView()) return;
+
         auto AnimIt = Animations.find(CurrentState.value());
         if (AnimIt == Animations.end()) return;
 
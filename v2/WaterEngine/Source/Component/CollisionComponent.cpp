@@ -162,6 +162,7 @@ namespace we
 		
 		OverlappingActors.insert(OtherActor);
 		OnBeginOverlap.Broadcast(OtherActor);
+		Owner->GetWorld().GetEvents().Publish(OverlapEvent{ Owner->GetID(), OtherActor->GetID(), true }, Owner->GetID());
 	}
 
 	void CollisionComponent::OnComponentEndOverlap(b2Body* OtherBody)
@@ -176,6 +177,7 @@ namespace we
 		
 		OverlappingActors.erase(OtherActor);
 		OnEndOverlap.Broadcast(OtherActor);
+		Owner->GetWorld().GetEvents().Publish(OverlapEvent{ Owner->GetID(), OtherActor->GetID(), false }, Owner->GetID());
 	}
 
 	bool CollisionComponent::IsOtherActor(Actor* CheckActor) const
@@ -193,6 +195,7 @@ namespace we
 			if ((*It)->IsPendingDestroy())
 			{
 				OnEndOverlap.Broadcast(*It);
+				Owner->GetWorld().GetEvents().Publish(OverlapEvent{ Owner->GetID(), (*It)->GetID(), false }, Owner->GetID());
 				It = OverlappingActors.erase(It);
 			}
 			else
@@ -5,6 +5,8 @@
 
 #include "Component/MovementComponent.h"
 #include "Framework/World/Actor.h"
+#include "Framework/World/World.h"
+#include "Subsystem/NavigationSubsystem.h"
 #include "Utility/Math.h"
 
 namespace we
@@ -23,16 +25,39 @@ namespace we
 		if (!Owner)
 			return;
 
+		if (FlowField != INVALID_FLOW_FIELD)
+		{
+			AddInputVector(Owner->GetWorld().GetNavigation().GetFlowDirection(FlowField, Owner->GetPosition() + FlowFieldOffset));
+		}
+
 		Velocity = CalculateVelocity();
+		if (TravelLimit && DeltaTime > 0.0f)
+		{
+			const float MaxSpeed = *TravelLimit / DeltaTime;
+			if (LengthSquared(Velocity) > MaxSpeed * MaxSpeed)
+			{
+				Velocity = Normalize(Velocity) * MaxSpeed;
+			}
+		}
+		TravelLimit.reset();
 		
 		if (bAutoOrient && bIsMoving)
 		{
 			UpdateOrientation();
 		}
 
-		OnVelocityCalculated.Broadcast(Velocity);
-		
 		InputVector = {};
+
+		if (AvoidanceRadius > 0.0f)
+		{
+			Owner->GetWorld().GetCrowd().Submit(*this, Owner->GetPosition() + AvoidanceOffset, Velocity, AvoidanceRadius, bAvoidanceSteers);
+
+			// Steering agents broadcast once the crowd is resolved
+			if (bAvoidanceSteers)
+				return;
+		}
+
+		OnVelocityCalculated.Broadcast(Velocity);
 	}
 
 	void MovementComponent::EndPlay()
@@ -54,6 +79,26 @@ namespace we
 		InputVector = {};
 	}
 
+	void MovementComponent::EnableAvoidance(float Radius, vec2f Offset, bool bSteer)
+	{
+		AvoidanceRadius = Radius;
+		AvoidanceOffset = Offset;
+		bAvoidanceSteers = bSteer;
+	}
+
+	void MovementComponent::ApplyAvoidance(const vec2f& InVelocity)
+	{
+		// Facing stays on the desired direction, so sidesteps don't flip the walk animation
+		Velocity = InVelocity;
+		OnVelocityCalculated.Broadcast(Velocity);
+	}
+
+	void MovementComponent::FollowFlowField(FlowFieldID ID, vec2f Offset)
+	{
+		FlowField = ID;
+		FlowFieldOffset = Offset;
+	}
+
 	vec2f MovementComponent::GetInputDirection() const
 	{
 		return LengthSquared(InputVector) > 0.001f ? Normalize(InputVector) : vec2f{};
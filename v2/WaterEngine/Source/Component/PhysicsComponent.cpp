@@ -6,6 +6,7 @@
 #include "Component/PhysicsComponent.h"
 #include "Framework/World/Actor.h"
 #include "Framework/World/World.h"
+#include "Framework/World/WorldSnapshot.h"
 #include "Subsystem/PhysicsSubsystem.h"
 #include "Core/EngineConfig.h"
 #include "box2d/b2_body.h"
@@ -30,6 +31,7 @@ namespace we
             if (Owner)
             {
                 auto& Physics = Owner->GetWorld().GetPhysics();
+                Physics.UnregisterSyncedBody(this);
                 Physics.MarkForDestruction(Body);
             }
         }
@@ -70,6 +72,7 @@ namespace we
         }
 
         Body->GetUserData().pointer = reinterpret_cast<uintptr_t>(this);
+        Physics.RegisterSyncedBody(this);
 
         CreateFixture();
     }
@@ -156,9 +159,7 @@ namespace we
 
     void PhysicsComponent::Tick(float DeltaTime)
     {
-        if (!Body || !Owner) return;
-
-        SyncActorToBody();
+        // The owner is moved to the body by PhysicsSubsystem right after the step
     }
 
     void PhysicsComponent::EndPlay()
@@ -174,10 +175,12 @@ namespace we
         if (Owner)
         {
             auto& Physics = Owner->GetWorld().GetPhysics();
+            Physics.UnregisterSyncedBody(this);
             Physics.MarkForDestruction(Body);
         }
 
         Body = nullptr;
+        PendingVelocity.reset();
     }
 
     Actor* PhysicsComponent::GetOwner() const
@@ -251,16 +254,13 @@ namespace we
     {
         if (!Body) return;
 
-        auto& Physics = Owner->GetWorld().GetPhysics();
-        Body->SetLinearVelocity(b2Vec2(
-            Physics.PixelsToMeters(Velocity.x),
-            Physics.PixelsToMeters(Velocity.y)
-        ));
+        PendingVelocity = Velocity;
     }
 
     vec2f PhysicsComponent::GetVelocity() const
     {
         if (!Body) return vec2f{};
+        if (PendingVelocity) return *PendingVelocity;
 
         auto& Physics = Owner->GetWorld().GetPhysics();
         b2Vec2 Vel = Body->GetLinearVelocity();
@@ -270,6 +270,22 @@ namespace we
         );
     }
 
+    void PhysicsComponent::SaveState(SnapshotWriter& Out) const
+    {
+        Out.Write(GetVelocity());
+    }
+
+    void PhysicsComponent::LoadState(SnapshotReader& In)
+    {
+        In.Read(RestoredVelocity);
+
+        // Components that never created a body will get one in BeginPlay anyway
+        if (Body && Owner)
+        {
+            Owner->GetWorld().GetPhysics().QueueBodyRebuild(this);
+        }
+    }
+
     void PhysicsComponent::SyncBodyToActor()
     {
         if (!Body || !Owner) return;
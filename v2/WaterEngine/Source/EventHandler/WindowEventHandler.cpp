@@ -13,7 +13,7 @@ namespace we
     // =========================================================================
     void WindowEventHandler::operator()(const event::Closed&)
     {
-        Window.close();
+        Window.CloseWindow();
     }
 
     void WindowEventHandler::operator()(const event::Resized&)
@@ -4,6 +4,7 @@
 // =============================================================================
 
 #include "Framework/WaterEngine.h"
+#include "Utility/Log.h"
 
 namespace we
 {
@@ -31,8 +32,19 @@ namespace we
         Subsystem.GUI      = make_unique<GUISubsystem>();
         Subsystem.Save     = make_shared<SaveSubsystem>();
         Subsystem.Physics  = make_shared<PhysicsSubsystem>();
+        Subsystem.Navigation = make_shared<NavigationSubsystem>(*Subsystem.Physics);
+
+        if (WEConfig.Render.bUseRenderThread)
+        {
+            RenderWorker = make_unique<RenderThread>(*Subsystem.Render, *Subsystem.Window);
+        }
 
         BindDelegates();
+
+        if (RenderWorker)
+        {
+            RenderWorker->Start();
+        }
     }
 
     void WaterEngine::BindDelegates()
@@ -43,6 +55,14 @@ namespace we
 
         Subsystem.Camera->OnViewUpdate.Bind(Subsystem.GUI.get(), &GUISubsystem::SetCameraView);
 
+        if (RenderWorker)
+        {
+            // Release the context before the window is destroyed, and wait out in-flight frames before GC
+            Subsystem.Window->OnBeforeClose.Bind(RenderWorker.get(), &RenderThread::Stop);
+            Subsystem.Window->OnRecreated.Bind(RenderWorker.get(), &RenderThread::Start);
+            GetTimer().TriggerGarbageCollection.Bind(RenderWorker.get(), &RenderThread::WaitIdle);
+        }
+
         GetTimer().TriggerGarbageCollection.Bind(Subsystem.Resource.get(), &ResourceSubsystem::GarbageCollect);
 
         Subsystem.GUI->Initialize(Subsystem.Render->GetScreenUITarget(), Subsystem.Render->GetWorldUITarget());
@@ -51,7 +71,13 @@ namespace we
         Subsystem.GUI->SetCameraWorldPosition(Subsystem.Camera->GetViewPosition());
         Subsystem.GUI->OnFullscreenRequested.Bind(Subsystem.Window.get(), &WindowSubsystem::SetFullscreen);
 
+        // Redrawn only when they change, see DrawUILayers
+        Subsystem.Render->SetLayerRetained(ERenderLayer::WorldUI, true);
+        Subsystem.Render->SetLayerRetained(ERenderLayer::ScreenUI, true);
+        Subsystem.Render->SetLayerRetained(ERenderLayer::Cursor, true);
+
         Subsystem.World->SetPhysicsRef(Subsystem.Physics);
+        Subsystem.World->SetNavigationRef(Subsystem.Navigation);
         Subsystem.World->SetCameraRef(Subsystem.Camera);
         Subsystem.World->SetSaveRef(Subsystem.Save);
     }
@@ -75,19 +101,49 @@ namespace we
 
     void WaterEngine::ProcessEvents()
     {
+        Subsystem.Input->BeginFrame();
+
         while (const auto Event = Subsystem.Window->pollEvent())
         {
             Subsystem.Window->HandleEvent(*Event);
 
+            if (const auto* Key = Event->getIf<event::KeyPressed>())
+            {
+                HandleDebugHotkey(Key->scancode);
+            }
+
             if (Subsystem.GUI->HandleEvent(*Event)) { continue; }
 
             Subsystem.Input->HandleEvent(*Event);           
         }
     }
 
+    void WaterEngine::HandleDebugHotkey(sf::Keyboard::Scan Key)
+    {
+        if (Key == WEConfig.Input.RenderCaptureKey)
+        {
+            Subsystem.Render->RequestCapture(WEConfig.Render.CaptureFileName, WEConfig.Render.CaptureFrameCount);
+        }
+        else if (Key == WEConfig.Input.InputRecordKey)
+        {
+            if (Subsystem.Input->IsRecording())
+                Subsystem.Input->StopRecording(WEConfig.Input.InputRecordingFileName);
+            else
+                Subsystem.Input->StartRecording();
+        }
+        else if (Key == WEConfig.Input.InputReplayKey)
+        {
+            if (Subsystem.Input->IsReplaying())
+                Subsystem.Input->StopReplay();
+            else
+                Subsystem.Input->StartReplay(WEConfig.Input.InputRecordingFileName);
+        }
+    }
+
     void WaterEngine::Update()
     {
         Subsystem.Clock->Tick();
+        Subsystem.Input->SyncClock(*Subsystem.Clock);
         
         if (Subsystem.World->IsPaused() && !Subsystem.Clock->IsPaused())
         {
@@ -102,6 +158,8 @@ namespace we
         GetTimer().Update(DeltaTime);
         Subsystem.World->Tick(DeltaTime);
         Subsystem.Physics->Tick(DeltaTime);
+        Subsystem.Navigation->Tick();
+        Subsystem.Audio->SetListenerPosition(Subsystem.Camera->GetViewPosition());
         Subsystem.Audio->Update(DeltaTime);
     }
 
@@ -109,12 +167,17 @@ namespace we
     {
         if (Subsystem.World->ShouldQuit())
         {
-            Subsystem.Window->close();
+            Subsystem.Window->CloseWindow();
         }
     }
 
     void WaterEngine::Shutdown()
     {
+        if (RenderWorker)
+        {
+            RenderWorker->Stop();
+        }
+
         if (Subsystem.GameInstance)
         {
             Subsystem.GameInstance->Shutdown();
@@ -127,6 +190,12 @@ namespace we
 
     void WaterEngine::Render()
     {
+        if (RenderWorker && RenderWorker->IsRunning())
+        {
+            RenderThreaded();
+            return;
+        }
+
         // Get camera view data from CameraSubsystem
         vec2f CamPos = Subsystem.Camera->GetViewPosition();
         float CamZoom = Subsystem.Camera->GetViewZoom();
@@ -141,19 +210,7 @@ namespace we
             Subsystem.Render->Draw(*Sprite, ERenderLayer::World);
         }
 
-        // WorldUI layer - update camera position and sync world positions before draw
-        Subsystem.GUI->SetCameraWorldPosition(Subsystem.Camera->GetViewPosition());
-        Subsystem.GUI->SyncWorldPositions();
-        Subsystem.GUI->GetWorldUI().draw();
-
-        // ScreenUI layer
-        Subsystem.GUI->GetScreenUI().draw();
-
-        // Cursor layer
-        if (const auto* CursorDrawable = Subsystem.Cursor->GetDrawable())
-        {
-            Subsystem.Render->Draw(*CursorDrawable, ERenderLayer::Cursor);
-        }
+        DrawUILayers();
 
         Subsystem.Render->EndFrame();
 
@@ -163,4 +220,99 @@ namespace we
         Subsystem.Window->draw(Subsystem.Render->GetCompositeSprite());
         Subsystem.Window->display();
     }
+
+    void WaterEngine::RenderThreaded()
+    {
+        // The static layer cache and TGUI draw into targets the render thread samples,
+        // so both wait until the previous frame has been presented
+        RenderWorker->WaitIdle();
+        BuildRenderFrame(RenderWorker->GetBackFrame());
+
+        Subsystem.Render->BeginFrame();
+        DrawUILayers();
+
+        Subsystem.Render->EndLayer(ERenderLayer::WorldUI);
+        Subsystem.Render->EndLayer(ERenderLayer::ScreenUI);
+        Subsystem.Render->EndLayer(ERenderLayer::Cursor);
+
+        RenderWorker->Submit();
+    }
+
+    void WaterEngine::BuildRenderFrame(RenderFrame& Frame)
+    {
+        Frame.Reset();
+        Frame.WorldViewCenter = Subsystem.Camera->GetViewPosition();
+        Frame.WorldViewZoom = Subsystem.Camera->GetViewZoom();
+        Frame.WorldViewRotation = Subsystem.Camera->GetViewRotation();
+        Frame.WindowView = Subsystem.Camera->GetView();
+
+        static vector<float> Depths;
+        const auto& Drawables = Subsystem.World->GetOrderedDrawables(&Depths);
+        Frame.Commands.reserve(Drawables.size());
+
+        for (ulong i = 0; i < Drawables.size(); ++i)
+        {
+            if (auto Command = DrawCommand::FromDrawable(*Drawables[i], ERenderLayer::World, Depths[i]))
+            {
+                Frame.Commands.push_back(*Command);
+            }
+            else
+            {
+                static bool bWarned = false;
+                if (!bWarned)
+                {
+                    WARNING("[Render] Drawables other than sprites, shapes and vertex arrays are not drawn on the render thread");
+                    bWarned = true;
+                }
+            }
+        }
+
+        Subsystem.World->CollectSpriteTextures(Frame.RetainedTextures);
+    }
+
+    void WaterEngine::DrawUILayers()
+    {
+        // The layers below are retained: each is invalidated when its content changed, and
+        // an invalidated layer with nothing to draw is cleared by the render subsystem
+
+        // WorldUI layer - update camera position and sync world positions before checking for changes
+        Subsystem.GUI->SetCameraWorldPosition(Subsystem.Camera->GetViewPosition());
+        if (Subsystem.GUI->IsWorldUIActive())
+        {
+            Subsystem.GUI->SyncWorldPositions();
+        }
+        if (Subsystem.GUI->ConsumeWorldUIChanges())
+        {
+            Subsystem.Render->InvalidateLayer(ERenderLayer::WorldUI);
+        }
+        if (Subsystem.GUI->IsWorldUIActive() && Subsystem.Render->NeedsRedraw(ERenderLayer::WorldUI))
+        {
+            Subsystem.Render->BeginLayer(ERenderLayer::WorldUI);
+            Subsystem.GUI->GetWorldUI().draw();
+        }
+
+        // ScreenUI layer
+        if (Subsystem.GUI->ConsumeScreenUIChanges())
+        {
+            Subsystem.Render->InvalidateLayer(ERenderLayer::ScreenUI);
+        }
+        if (Subsystem.GUI->IsScreenUIActive() && Subsystem.Render->NeedsRedraw(ERenderLayer::ScreenUI))
+        {
+            Subsystem.Render->BeginLayer(ERenderLayer::ScreenUI);
+            Subsystem.GUI->GetScreenUI().draw();
+        }
+
+        // Cursor layer
+        if (Subsystem.Cursor->ConsumeChanges())
+        {
+            Subsystem.Render->InvalidateLayer(ERenderLayer::Cursor);
+        }
+        if (Subsystem.Render->NeedsRedraw(ERenderLayer::Cursor))
+        {
+            if (const auto* CursorDrawable = Subsystem.Cursor->GetDrawable())
+            {
+                Subsystem.Render->Draw(*CursorDrawable, ERenderLayer::Cursor);
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -4,11 +4,23 @@
 // =============================================================================
 
 #include "Framework/World/Actor.h"
+#include "Framework/World/World.h"
+#include "Framework/World/WorldSnapshot.h"
 #include "Utility/Log.h"
 
 namespace we
 {
+	namespace Detail
+	{
+		TypeID NextTypeID()
+		{
+			static TypeID Next = INVALID_TYPE_ID + 1;
+			return Next++;
+		}
+	}
+
 	ActorID Actor::NextID = 1;
+	vector<vector<optional<Actor::CastEntry>>> Actor::CastCache;
 
 	Actor::Actor(World& OwningWorld)
 		: UniqueID(NextID++)
@@ -19,7 +31,15 @@ namespace we
 		, ActorSprite{}
 		, CustomDepth{}
 		, bIsVisible{true}
+		, bIsStatic{false}
+		, bRenderStateQueued{false}
 		, bHasBegunPlay{false}
+		, bSnapshotEnabled{false}
+		, TickAccumulator{0.0f}
+		, bAlwaysRelevant{false}
+		, bIsInView{true}
+		, LastTickFrame{0}
+		, LastTickDelta{0.0f}
 	{
 	}
 
@@ -40,10 +60,73 @@ namespace we
 	{
 		if (!IsPendingDestroy())
 		{
+			LastTickFrame = OwningWorld.GetFrameNumber();
+			LastTickDelta = DeltaTime;
 			Tick(DeltaTime);
 		}
 	}
 
+	const Actor::CastEntry& Actor::FindCast(TypeID Target, const void* (*Resolve)(Actor&))
+	{
+		auto Compute = [&]()
+		{
+			const void* Result = Resolve(*this);
+			CastEntry Entry;
+			Entry.bValid = Result != nullptr;
+			Entry.Offset = Result ? static_cast<const std::byte*>(Result) - reinterpret_cast<const std::byte*>(this) : 0;
+			return Entry;
+		};
+
+		// Not spawned through the world, so there is no concrete type to cache against
+		if (ConcreteType == INVALID_TYPE_ID)
+		{
+			static CastEntry Uncached;
+			Uncached = Compute();
+			return Uncached;
+		}
+
+		if (CastCache.size() <= ConcreteType)
+		{
+			CastCache.resize(ConcreteType + 1);
+		}
+
+		auto& Row = CastCache[ConcreteType];
+		if (Row.size() <= Target)
+		{
+			Row.resize(Target + 1);
+		}
+
+		if (!Row[Target])
+		{
+			Row[Target] = Compute();
+		}
+		return *Row[Target];
+	}
+
+	void Actor::SetTag(uint Tag, bool bSet)
+	{
+		if (Tag >= MAX_ACTOR_TAGS)
+		{
+			ERROR("[Actor] Tag {} is out of range", Tag);
+			return;
+		}
+		if (Tags.test(Tag) == bSet) return;
+
+		Tags.set(Tag, bSet);
+		if (bIndexed)
+		{
+			OwningWorld.UpdateTagIndex(*this, Tag, bSet);
+		}
+	}
+
+	optional<float> Actor::GetFrameTickDelta() const
+	{
+		if (LastTickFrame != OwningWorld.GetFrameNumber())
+			return std::nullopt;
+
+		return LastTickDelta;
+	}
+
 	void Actor::BeginPlay()
 	{
 	}
@@ -57,6 +140,65 @@ namespace we
 	{
 	}
 
+	void Actor::SaveState(SnapshotWriter& Out) const
+	{
+		Out.Write(Position);
+		Out.Write(Rotation.asRadians());
+		Out.Write(Scale);
+		Out.Write(bIsVisible);
+		Out.Write(CustomDepth.has_value());
+		Out.Write(CustomDepth.value_or(0.0f));
+	}
+
+	void Actor::LoadState(SnapshotReader& In)
+	{
+		float Radians = 0.0f;
+		bool bHasCustomDepth = false;
+		float Depth = 0.0f;
+
+		In.Read(Position);
+		In.Read(Radians);
+		In.Read(Scale);
+		In.Read(bIsVisible);
+		In.Read(bHasCustomDepth);
+		In.Read(Depth);
+
+		Rotation = sf::radians(Radians);
+		CustomDepth = bHasCustomDepth ? optional<float>{Depth} : std::nullopt;
+		UpdateTransform();
+
+		if (bIsStatic)
+		{
+			MarkRenderStateChanged();
+		}
+	}
+
+	void Actor::SetStatic(bool bStatic)
+	{
+		if (bIsStatic == bStatic) return;
+
+		// Either way the static layer has to add or drop this actor
+		bIsStatic = bStatic;
+		MarkRenderStateChanged();
+	}
+
+	void Actor::MarkRenderStateChanged()
+	{
+		// Actors not registered yet are queued when the world registers them
+		if (bRenderStateQueued || !bIndexed) return;
+
+		bRenderStateQueued = true;
+		OwningWorld.QueueStaticChange(UniqueID);
+	}
+
+	void Actor::OnPendingDestroy()
+	{
+		if (bIsStatic)
+		{
+			MarkRenderStateChanged();
+		}
+	}
+
 	void Actor::UpdateTransform()
 	{
 		if (HasSprite())
@@ -83,6 +225,12 @@ namespace we
 		{
 			ActorSprite->setTexture(*Texture, true);
 		}
+		SpriteTexture = Texture;
+
+		if (bIsStatic)
+		{
+			MarkRenderStateChanged();
+		}
 	}
 
 	void Actor::SetSpriteOrigin(const vec2f& Origin)
@@ -90,6 +238,10 @@ namespace we
 		if (HasSprite())
 		{
 			ActorSprite->setOrigin(Origin);
+			if (bIsStatic)
+			{
+				MarkRenderStateChanged();
+			}
 		}
 	}
 
@@ -98,6 +250,10 @@ namespace we
 		if (HasSprite())
 		{
 			ActorSprite->setTextureRect(TexRect);
+			if (bIsStatic)
+			{
+				MarkRenderStateChanged();
+			}
 		}
 	}
 
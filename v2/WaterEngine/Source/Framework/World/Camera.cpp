@@ -4,6 +4,7 @@
 // =============================================================================
 
 #include "Framework/World/Camera.h"
+#include "Framework/World/World.h"
 #include "Component/CameraComponent.h"
 #include "Utility/Log.h"
 
@@ -11,11 +12,16 @@ namespace we
 {
 	Camera::Camera(World& InWorld)
 		: Actor(InWorld)
-		, CamComp(make_shared<CameraComponent>(this))
+		, CamComp(InWorld.GetComponents().Create<CameraComponent>(this))
 	{
+		// The view itself, so never throttled by distance to it
+		SetAlwaysRelevant(true);
 	}
 
-	Camera::~Camera() = default;
+	Camera::~Camera()
+	{
+		GetWorld().GetComponents().Destroy(CamComp);
+	}
 
 	void Camera::BeginPlay()
 	{
@@ -24,23 +30,13 @@ namespace we
 		CamComp->BeginPlay();
 	}
 
-	void Camera::Tick(float DeltaTime)
-	{
-		Actor::Tick(DeltaTime);
-
-		if (CamComp)
-		{
-			CamComp->Tick(DeltaTime);
-		}
-	}
-
 	void Camera::EndPlay()
 	{
 
 		if (CamComp)
 		{
 			CamComp->EndPlay();
-			CamComp.reset();
+			GetWorld().GetComponents().Destroy(CamComp);
 		}
 
 		Actor::EndPlay();
@@ -48,7 +44,7 @@ namespace we
 
 	CameraComponent* Camera::GetCameraComponent() const
 	{
-		return CamComp.get();
+		return CamComp.Get();
 	}
 
 	void Camera::SetActive()
@@ -4,6 +4,8 @@
 // =============================================================================
 
 #include "Framework/World/Character.h"
+#include "Framework/World/World.h"
+#include "Framework/World/WorldSnapshot.h"
 #include "Component/AnimationComponent.h"
 #include "Component/PhysicsComponent.h"
 #include "Component/MovementComponent.h"
@@ -16,21 +18,38 @@ namespace we
 	Character::Character(World& InWorld)
 		: Actor(InWorld)
 	{
-		AnimComp = make_shared<AnimationComponent>(this);
-		PhysicsComp = make_shared<PhysicsComponent>(this);
-		MoveComp = make_shared<MovementComponent>(this);
-		CollComp = make_shared<CollisionComponent>(this);
-		CameraComp = make_shared<CameraComponent>(this);
+		ComponentRegistry& Components = InWorld.GetComponents();
+		AnimComp = Components.Create<AnimationComponent>(this);
+		PhysicsComp = Components.Create<PhysicsComponent>(this);
+		MoveComp = Components.Create<MovementComponent>(this);
+		CollComp = Components.Create<CollisionComponent>(this);
+		CameraComp = Components.Create<CameraComponent>(this);
 	}
 
-	Character::~Character() = default;
+	Character::~Character()
+	{
+		// Characters that never began play still own their pool slots
+		ReleaseComponents();
+	}
+
+	void Character::SaveState(SnapshotWriter& Out) const
+	{
+		Actor::SaveState(Out);
+		PhysicsComp->SaveState(Out);
+	}
+
+	void Character::LoadState(SnapshotReader& In)
+	{
+		Actor::LoadState(In);
+		PhysicsComp->LoadState(In);
+	}
 
 	void Character::BeginPlay()
 	{
 		Actor::BeginPlay();
 
 		// Bind movement velocity to physics body
-		MoveComp->OnVelocityCalculated.Bind(PhysicsComp.get(), &PhysicsComponent::SetVelocity);
+		MoveComp->OnVelocityCalculated.Bind(PhysicsComp.Get(), &PhysicsComponent::SetVelocity);
 
 		// Initialize all components
 		AnimComp->BeginPlay();
@@ -41,50 +60,26 @@ namespace we
 		CameraComp->BeginPlay();
 	}
 
-	void Character::Tick(float DeltaTime)
+	void Character::EndPlay()
 	{
-		Actor::Tick(DeltaTime);
+		if (AnimComp) AnimComp->EndPlay();
+		if (CollComp) CollComp->EndPlay();
+		if (MoveComp) MoveComp->EndPlay();
+		if (PhysicsComp) PhysicsComp->EndPlay();
+		if (CameraComp) CameraComp->EndPlay();
 
-		if (MoveComp) MoveComp->Tick(DeltaTime);
-		if (PhysicsComp) PhysicsComp->Tick(DeltaTime);
-		if (CollComp) CollComp->Tick(DeltaTime);
-		if (AnimComp) AnimComp->Tick(DeltaTime);
-		if (CameraComp) CameraComp->Tick(DeltaTime);
+		ReleaseComponents();
+		Actor::EndPlay();
 	}
 
-	void Character::EndPlay()
+	void Character::ReleaseComponents()
 	{
-		if (AnimComp)
-		{
-			AnimComp->EndPlay();
-			AnimComp.reset();
-		}
-
-		if (CollComp)
-		{
-			CollComp->EndPlay();
-			CollComp.reset();
-		}
-
-		if (MoveComp)
-		{
-			MoveComp->EndPlay();
-			MoveComp.reset();
-		}
-
-		if (PhysicsComp)
-		{
-			PhysicsComp->EndPlay();
-			PhysicsComp.reset();
-		}
-
-		if (CameraComp)
-		{
-			CameraComp->EndPlay();
-			CameraComp.reset();
-		}
-
-		Actor::EndPlay();
+		ComponentRegistry& Components = GetWorld().GetComponents();
+		Components.Destroy(AnimComp);
+		Components.Destroy(CollComp);
+		Components.Destroy(MoveComp);
+		Components.Destroy(PhysicsComp);
+		Components.Destroy(CameraComp);
 	}
 
 	void Character::GetDrawables(vector<const drawable*>& OutDrawables) const
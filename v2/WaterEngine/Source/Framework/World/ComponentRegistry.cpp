@@ -0,0 +1,33 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/ComponentRegistry.h"
+#include "Component/MovementComponent.h"
+#include "Component/PhysicsComponent.h"
+#include "Component/CollisionComponent.h"
+#include "Component/AnimationComponent.h"
+#include "Component/CameraComponent.h"
+
+namespace we
+{
+	ComponentRegistry::ComponentRegistry()
+	{
+		// Movement queues velocity for the next physics step; the rest read the position
+		// PhysicsSubsystem synced after the last one
+		GetPool<MovementComponent>();
+		GetPool<PhysicsComponent>();
+		GetPool<CollisionComponent>();
+		GetPool<AnimationComponent>();
+		GetPool<CameraComponent>();
+	}
+
+	void ComponentRegistry::TickSystems()
+	{
+		for (IComponentPool* Pool : TickOrder)
+		{
+			Pool->TickAll();
+		}
+	}
+}
@@ -0,0 +1,210 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/CrowdAvoidance.h"
+#include "Component/MovementComponent.h"
+#include "Core/EngineConfig.h"
+#include "Utility/JobSystem.h"
+#include "Utility/Math.h"
+
+#include <cmath>
+
+namespace we
+{
+	void CrowdAvoidance::Submit(MovementComponent& Agent, vec2f Position, vec2f Velocity, float Radius, bool bSteers)
+	{
+		Agents.push_back(&Agent);
+		Positions.push_back(Position);
+		Velocities.push_back(Velocity);
+		Radii.push_back(Radius);
+		Steers.push_back(bSteers ? 1 : 0);
+		MaxRadius = Max(MaxRadius, Radius);
+	}
+
+	void CrowdAvoidance::Resolve()
+	{
+		const ulong Count = Agents.size();
+		if (Count == 0) return;
+
+		BuildHash();
+		Adjusted.resize(Count);
+
+		// Each agent only reads the shared arrays and writes its own slot, so chunks of agents
+		// can run on any thread. Small crowds are cheaper than waking the workers
+		auto Steer = [this](ulong Begin, ulong End)
+		{
+			for (ulong i = Begin; i < End; ++i)
+			{
+				Adjusted[i] = Steers[i] ? ComputeVelocity(i) : Velocities[i];
+			}
+		};
+
+		if (Count >= WEConfig.Crowd.ParallelThreshold)
+		{
+			GetJobs().ParallelFor(Count, 64, Steer);
+		}
+		else
+		{
+			Steer(0, Count);
+		}
+
+		// Delegates are not thread-safe, so results go back on the game thread
+		for (ulong i = 0; i < Count; ++i)
+		{
+			if (Steers[i])
+			{
+				Agents[i]->ApplyAvoidance(Adjusted[i]);
+			}
+		}
+
+		Agents.clear();
+		Positions.clear();
+		Velocities.clear();
+		Radii.clear();
+		Steers.clear();
+		MaxRadius = 0.0f;
+	}
+
+	void CrowdAvoidance::BuildHash()
+	{
+		const ulong Count = Agents.size();
+
+		// At least twice as many buckets as agents keeps unrelated cells from sharing buckets
+		uint BucketCount = 64;
+		while (BucketCount < Count * 2)
+		{
+			BucketCount *= 2;
+		}
+		BucketMask = BucketCount - 1;
+
+		Cells.resize(Count);
+		BucketStart.assign(BucketCount + 1, 0);
+		for (ulong i = 0; i < Count; ++i)
+		{
+			Cells[i] = GetCell(Positions[i]);
+			++BucketStart[GetBucket(Cells[i])];
+		}
+
+		// Running totals leave each entry at the end of its bucket
+		for (uint Bucket = 1; Bucket <= BucketCount; ++Bucket)
+		{
+			BucketStart[Bucket] += BucketStart[Bucket - 1];
+		}
+
+		// Filling backwards walks each entry down to the start of its bucket
+		Sorted.resize(Count);
+		for (ulong i = Count; i-- > 0;)
+		{
+			Sorted[--BucketStart[GetBucket(Cells[i])]] = static_cast<uint>(i);
+		}
+	}
+
+	vec2f CrowdAvoidance::ComputeVelocity(ulong Index) const
+	{
+		const vec2f Position = Positions[Index];
+		const vec2f Velocity = Velocities[Index];
+		const float Radius = Radii[Index];
+		const float Speed = Length(Velocity);
+
+		// Idle agents hold their ground and leave the moving ones to go around
+		if (Speed < EPSILON) return Velocity;
+
+		const float Padding = WEConfig.Crowd.Padding;
+		const float Horizon = WEConfig.Crowd.TimeHorizon;
+
+		// Anyone further than this cannot be reached within the horizon, even head-on
+		const float Reach = Radius + MaxRadius + Padding + Speed * Horizon * 2.0f;
+
+		// Nearest neighbors by distance, kept sorted
+		array<pair<float, uint>, CrowdConfig::MaxNeighbors> Nearest;
+		ulong NearestCount = 0;
+
+		const vec2i Low = GetCell(Position - vec2f{ Reach, Reach });
+		const vec2i High = GetCell(Position + vec2f{ Reach, Reach });
+		for (int Y = Low.y; Y <= High.y; ++Y)
+		{
+			for (int X = Low.x; X <= High.x; ++X)
+			{
+				const vec2i Cell{ X, Y };
+				const uint Bucket = GetBucket(Cell);
+				for (uint k = BucketStart[Bucket]; k < BucketStart[Bucket + 1]; ++k)
+				{
+					const uint Other = Sorted[k];
+
+					// Other cells hashed into this bucket are visited with their own cell
+					if (Other == Index || Cells[Other] != Cell) continue;
+
+					const float DistanceSq = DistanceSquared(Position, Positions[Other]);
+					if (DistanceSq > Reach * Reach) continue;
+					if (NearestCount == Nearest.size() && DistanceSq >= Nearest.back().first) continue;
+
+					ulong Slot = Min(NearestCount, Nearest.size() - 1);
+					while (Slot > 0 && Nearest[Slot - 1].first > DistanceSq)
+					{
+						Nearest[Slot] = Nearest[Slot - 1];
+						--Slot;
+					}
+					Nearest[Slot] = { DistanceSq, Other };
+					NearestCount = Min(NearestCount + 1, Nearest.size());
+				}
+			}
+		}
+
+		// Sidestep to the right when a collision is dead ahead; both agents doing so pass cleanly
+		const vec2f Right = -Perpendicular(Velocity / Speed);
+
+		vec2f Steer;
+		for (ulong n = 0; n < NearestCount; ++n)
+		{
+			const uint Other = Nearest[n].second;
+			const vec2f Offset = Position - Positions[Other];
+			const float Dist = std::sqrt(Nearest[n].first);
+			const float Combined = Radius + Radii[Other] + Padding;
+
+			// Already too close: push straight apart
+			if (Dist < Combined)
+			{
+				const vec2f Away = Dist > EPSILON ? Offset / Dist : Right;
+				Steer += Away * ((Combined - Dist) / Combined) * Speed;
+				continue;
+			}
+
+			// Predicted closest approach if both keep their velocity
+			const vec2f Relative = Velocity - Velocities[Other];
+			const float RelativeSq = LengthSquared(Relative);
+			if (RelativeSq < EPSILON) continue;
+
+			const float Time = -Dot(Offset, Relative) / RelativeSq;
+			if (Time <= 0.0f || Time > Horizon) continue;
+
+			const vec2f Closest = Offset + Relative * Time;
+			const float ClosestDist = Length(Closest);
+			if (ClosestDist >= Combined) continue;
+
+			const vec2f Side = ClosestDist > EPSILON ? Closest / ClosestDist : Right;
+			const float Urgency = 1.0f - Time / Horizon;
+			Steer += Side * ((Combined - ClosestDist) / Combined) * Urgency * Speed;
+		}
+
+		// Turning and slowing down are fine, speeding up is not
+		const vec2f Result = Velocity + Steer * WEConfig.Crowd.Strength;
+		const float ResultSpeed = Length(Result);
+		return ResultSpeed > Speed ? Result * (Speed / ResultSpeed) : Result;
+	}
+
+	vec2i CrowdAvoidance::GetCell(vec2f Position) const
+	{
+		const float CellSize = WEConfig.Crowd.CellSize;
+		return {
+			static_cast<int>(std::floor(Position.x / CellSize)),
+			static_cast<int>(std::floor(Position.y / CellSize))
+		};
+	}
+
+	uint CrowdAvoidance::GetBucket(vec2i Cell) const
+	{
+		return ((static_cast<uint>(Cell.x) * 73856093u) ^ (static_cast<uint>(Cell.y) * 19349663u)) & BucketMask;
+	}
+}
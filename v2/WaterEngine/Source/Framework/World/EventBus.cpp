@@ -0,0 +1,60 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/EventBus.h"
+#include "Utility/Log.h"
+
+namespace we
+{
+	namespace Detail
+	{
+		uint NextEventType()
+		{
+			static uint Next = 0;
+			return Next++;
+		}
+	}
+
+	void EventBus::Unsubscribe(EventListener Listener)
+	{
+		if (Listener.ID == 0 || Listener.Type >= Channels.size() || !Channels[Listener.Type]) return;
+
+		Channels[Listener.Type]->Remove(Listener.ID);
+	}
+
+	void EventBus::Dispatch()
+	{
+		if (bDispatching)
+		{
+			WARNING("[EventBus] Dispatch called from a listener, ignored");
+			return;
+		}
+		bDispatching = true;
+
+		// Every channel's queue is taken first, so events published during delivery, of any type,
+		// are left for the next dispatch. Indexed, as publishing a new type grows Channels
+		const ulong ChannelCount = Channels.size();
+		for (ulong i = 0; i < ChannelCount; ++i)
+		{
+			if (Channels[i]) Channels[i]->TakeQueued();
+		}
+		for (ulong i = 0; i < ChannelCount; ++i)
+		{
+			if (Channels[i]) Channels[i]->Deliver();
+		}
+
+		bDispatching = false;
+	}
+
+	ulong EventBus::GetQueuedCount() const
+	{
+		ulong Count = 0;
+		for (const auto& Entry : Channels)
+		{
+			if (Entry) Count += Entry->GetQueuedCount();
+		}
+		return Count;
+	}
+}
@@ -0,0 +1,277 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/LevelData.h"
+#include "Core/JsonTypes.h"
+#include "Utility/Log.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace we
+{
+	namespace
+	{
+		template<typename T>
+		void Write(string& Out, const T& Value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			Out.append(reinterpret_cast<const char*>(&Value), sizeof(T));
+		}
+
+		template<typename T>
+		void WriteArray(string& Out, const vector<T>& Values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			Write(Out, static_cast<uint>(Values.size()));
+			Out.append(reinterpret_cast<const char*>(Values.data()), Values.size() * sizeof(T));
+		}
+
+		// One byte per record size; the magic already differs under another byte order
+		constexpr uint GetRecordLayout()
+		{
+			static_assert(sizeof(LevelProp) < 256 && sizeof(LevelActor) < 256);
+			return static_cast<uint>(sizeof(LevelProp))
+				| static_cast<uint>(sizeof(LevelBarrier)) << 8
+				| static_cast<uint>(sizeof(LevelActor)) << 16
+				| static_cast<uint>(sizeof(LevelSpawn)) << 24;
+		}
+
+		class BinaryCursor
+		{
+		public:
+			explicit BinaryCursor(const string& InBytes) : Bytes{InBytes} {}
+
+			template<typename T>
+			bool Read(T& Value)
+			{
+				static_assert(std::is_trivially_copyable_v<T>);
+				if (Offset + sizeof(T) > Bytes.size()) return false;
+				std::memcpy(&Value, Bytes.data() + Offset, sizeof(T));
+				Offset += sizeof(T);
+				return true;
+			}
+
+			template<typename T>
+			bool ReadArray(vector<T>& Values)
+			{
+				uint Count = 0;
+				if (!Read(Count) || Offset + Count * sizeof(T) > Bytes.size()) return false;
+				Values.resize(Count);
+				if (Count > 0) std::memcpy(Values.data(), Bytes.data() + Offset, Count * sizeof(T));
+				Offset += Count * sizeof(T);
+				return true;
+			}
+
+			bool ReadString(string& Value)
+			{
+				uint16 Length = 0;
+				if (!Read(Length) || Offset + Length > Bytes.size()) return false;
+				Value.assign(Bytes.data() + Offset, Length);
+				Offset += Length;
+				return true;
+			}
+
+		private:
+			const string& Bytes;
+			ulong Offset = 0;
+		};
+
+		vec2f ReadVec(const json& Value)
+		{
+			return vec2f{ Value.at(0).get<float>(), Value.at(1).get<float>() };
+		}
+
+		uint AppendPoints(vector<vec2f>& Points, const json& Values)
+		{
+			const uint First = static_cast<uint>(Points.size());
+			for (const auto& Value : Values)
+			{
+				Points.push_back(ReadVec(Value));
+			}
+			return First;
+		}
+	}
+
+	const string& LevelData::GetString(LevelString Index) const
+	{
+		static const string Empty;
+		return Index >= 0 && Index < static_cast<int>(Strings.size()) ? Strings[Index] : Empty;
+	}
+
+	optional<LevelData> LevelData::FromJson(const string& Text)
+	{
+		json Root = json::parse(Text, nullptr, false);
+		if (Root.is_discarded() || !Root.is_object())
+		{
+			ERROR("[Level] Level text is not a JSON object");
+			return std::nullopt;
+		}
+
+		LevelData Level;
+		dictionary<string, LevelString> StringIndices;
+		auto Intern = [&](const json& Object, const char* Key) -> LevelString
+		{
+			if (!Object.contains(Key)) return NoString;
+
+			const string Value = Object.at(Key).get<string>();
+			auto [It, bInserted] = StringIndices.try_emplace(Value, static_cast<LevelString>(Level.Strings.size()));
+			if (bInserted) Level.Strings.push_back(Value);
+			return It->second;
+		};
+
+		try
+		{
+			const json Props = Root.value("props", json::array());
+			Level.Props.reserve(Props.size());
+			for (const auto& Entry : Props)
+			{
+				LevelProp& Prop = Level.Props.emplace_back();
+				Prop.Texture = Intern(Entry, "texture");
+				Prop.Shadow = Intern(Entry, "shadow");
+				Prop.Position = ReadVec(Entry.at("position"));
+				if (Entry.contains("origin")) Prop.Origin = ReadVec(Entry.at("origin"));
+				if (Entry.contains("depth"))
+				{
+					Prop.Depth = Entry.at("depth").get<float>();
+					Prop.bHasDepth = true;
+				}
+				Prop.ShadowDepth = Entry.value("shadowDepth", 10000.0f);
+				Prop.bPersistent = Entry.value("persistent", false);
+				if (Entry.contains("collision"))
+				{
+					const json& Collision = Entry.at("collision");
+					Prop.CollisionRadius = Collision.at("radius").get<float>();
+					if (Collision.contains("offset")) Prop.CollisionOffset = ReadVec(Collision.at("offset"));
+				}
+			}
+
+			const json Barriers = Root.value("barriers", json::array());
+			Level.Barriers.reserve(Barriers.size());
+			for (const auto& Entry : Barriers)
+			{
+				LevelBarrier& Line = Level.Barriers.emplace_back();
+				const json& Points = Entry.at("points");
+				Line.FirstPoint = AppendPoints(Level.Points, Points);
+				Line.PointCount = static_cast<uint>(Points.size());
+				Line.Thickness = Entry.value("thickness", 4.0f);
+				Line.bClosed = Entry.value("closed", false);
+			}
+
+			const json Actors = Root.value("actors", json::array());
+			Level.Actors.reserve(Actors.size());
+			for (const auto& Entry : Actors)
+			{
+				LevelActor& Placed = Level.Actors.emplace_back();
+				Placed.Type = Intern(Entry, "type");
+				Placed.Name = Intern(Entry, "name");
+				Placed.Position = ReadVec(Entry.at("position"));
+				Placed.bPersistent = Entry.value("persistent", false);
+				if (Entry.contains("waypoints"))
+				{
+					const json& Waypoints = Entry.at("waypoints");
+					Placed.FirstWaypoint = AppendPoints(Level.Points, Waypoints);
+					Placed.WaypointCount = static_cast<uint>(Waypoints.size());
+				}
+			}
+
+			const json Spawns = Root.value("spawns", json::array());
+			Level.Spawns.reserve(Spawns.size());
+			for (const auto& Entry : Spawns)
+			{
+				LevelSpawn& Spawn = Level.Spawns.emplace_back();
+				Spawn.Name = Intern(Entry, "name");
+				Spawn.Position = ReadVec(Entry.at("position"));
+			}
+		}
+		catch (const json::exception& Error)
+		{
+			ERROR("[Level] Malformed level: {}", Error.what());
+			return std::nullopt;
+		}
+
+		return Level;
+	}
+
+	string LevelData::ToBinary() const
+	{
+		string Out;
+		Out.reserve(64
+			+ Props.size() * sizeof(LevelProp)
+			+ Barriers.size() * sizeof(LevelBarrier)
+			+ Actors.size() * sizeof(LevelActor)
+			+ Spawns.size() * sizeof(LevelSpawn)
+			+ Points.size() * sizeof(vec2f));
+
+		Write(Out, Magic);
+		Write(Out, Version);
+		Write(Out, GetRecordLayout());
+
+		Write(Out, static_cast<uint>(Strings.size()));
+		for (const auto& Value : Strings)
+		{
+			Write(Out, static_cast<uint16>(Value.size()));
+			Out.append(Value);
+		}
+
+		WriteArray(Out, Props);
+		WriteArray(Out, Barriers);
+		WriteArray(Out, Actors);
+		WriteArray(Out, Spawns);
+		WriteArray(Out, Points);
+		return Out;
+	}
+
+	bool LevelData::IsCurrentBinary(const string& Bytes)
+	{
+		BinaryCursor In(Bytes);
+		uint FileMagic = 0;
+		uint16 FileVersion = 0;
+		uint FileLayout = 0;
+		return In.Read(FileMagic) && FileMagic == Magic
+			&& In.Read(FileVersion) && FileVersion == Version
+			&& In.Read(FileLayout) && FileLayout == GetRecordLayout();
+	}
+
+	optional<LevelData> LevelData::FromBinary(const string& Bytes)
+	{
+		if (!IsCurrentBinary(Bytes))
+		{
+			ERROR("[Level] Not a cooked level, or cooked by a different engine version or platform");
+			return std::nullopt;
+		}
+
+		BinaryCursor In(Bytes);
+		uint FileMagic = 0;
+		uint16 FileVersion = 0;
+		uint FileLayout = 0;
+		In.Read(FileMagic);
+		In.Read(FileVersion);
+		In.Read(FileLayout);
+
+		LevelData Level;
+		uint StringCount = 0;
+		bool bValid = In.Read(StringCount) && StringCount <= Bytes.size();
+		Level.Strings.resize(bValid ? StringCount : 0);
+		for (auto& Value : Level.Strings)
+		{
+			bValid = bValid && In.ReadString(Value);
+		}
+
+		bValid = bValid
+			&& In.ReadArray(Level.Props)
+			&& In.ReadArray(Level.Barriers)
+			&& In.ReadArray(Level.Actors)
+			&& In.ReadArray(Level.Spawns)
+			&& In.ReadArray(Level.Points);
+
+		if (!bValid)
+		{
+			ERROR("[Level] Cooked level is truncated");
+			return std::nullopt;
+		}
+		return Level;
+	}
+}
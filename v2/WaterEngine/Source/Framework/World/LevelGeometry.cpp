@@ -0,0 +1,126 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/LevelGeometry.h"
+#include "Framework/World/World.h"
+#include "Subsystem/PhysicsSubsystem.h"
+#include "Core/EngineConfig.h"
+#include "box2d/b2_body.h"
+#include "box2d/b2_circle_shape.h"
+#include "box2d/b2_polygon_shape.h"
+#include "box2d/b2_fixture.h"
+#include "Utility/Log.h"
+#include <cmath>
+
+namespace we
+{
+	LevelGeometry::LevelGeometry(World& InWorld)
+		: Actor(InWorld)
+	{
+		SetVisible(false);
+	}
+
+	LevelGeometry::~LevelGeometry() = default;
+
+	void LevelGeometry::Reserve(ulong CircleCount, ulong SegmentCount)
+	{
+		Circles.reserve(Circles.size() + CircleCount);
+		Segments.reserve(Segments.size() + SegmentCount);
+	}
+
+	void LevelGeometry::AddCircle(vec2f Center, float Radius)
+	{
+		Circles.push_back({ Center, Radius });
+	}
+
+	void LevelGeometry::AddPolyline(const vec2f* Points, ulong Count, bool bClosed, float Thickness)
+	{
+		if (Count < 2)
+		{
+			ERROR("[LevelGeometry] Need at least 2 points");
+			return;
+		}
+
+		const ulong SegmentCount = bClosed ? Count : Count - 1;
+		for (ulong i = 0; i < SegmentCount; ++i)
+		{
+			Segments.push_back({ Points[i], Points[(i + 1) % Count], Thickness });
+		}
+	}
+
+	void LevelGeometry::BeginPlay()
+	{
+		Actor::BeginPlay();
+
+		if (Circles.empty() && Segments.empty())
+			return;
+
+		auto& Physics = GetWorld().GetPhysics();
+
+		b2BodyDef BodyDef;
+		BodyDef.type = b2_staticBody;
+		BodyDef.position = b2Vec2(0.0f, 0.0f);
+
+		Body = Physics.CreateBody(BodyDef);
+		if (!Body)
+		{
+			ERROR("[LevelGeometry] Failed to create body");
+			return;
+		}
+		Body->GetUserData().pointer = 0;
+
+		b2FixtureDef FixtureDef;
+		FixtureDef.density = 0.0f;
+		FixtureDef.friction = 0.3f;
+		FixtureDef.restitution = 0.0f;
+		FixtureDef.isSensor = false;
+
+		// Same filter a static PhysicsComponent on the Physics channel uses
+		FixtureDef.filter.categoryBits = static_cast<uint16>(ECollisionChannel::Physics);
+		FixtureDef.filter.maskBits = static_cast<uint16>(ECollisionChannel::World) | static_cast<uint16>(ECollisionChannel::Physics);
+
+		for (const auto& Shape : Circles)
+		{
+			b2CircleShape CircleShape;
+			CircleShape.m_p = b2Vec2(Physics.PixelsToMeters(Shape.Center.x), Physics.PixelsToMeters(Shape.Center.y));
+			CircleShape.m_radius = Physics.PixelsToMeters(Shape.Radius);
+
+			FixtureDef.shape = &CircleShape;
+			Body->CreateFixture(&FixtureDef);
+		}
+
+		// Barriers keep Box2D's default filter
+		FixtureDef.filter = b2Filter{};
+
+		for (const auto& Shape : Segments)
+		{
+			vec2f Midpoint = (Shape.A + Shape.B) / 2.0f;
+			vec2f Delta = Shape.B - Shape.A;
+
+			b2PolygonShape BoxShape;
+			BoxShape.SetAsBox(
+				Physics.PixelsToMeters(Delta.length() / 2.0f),
+				Physics.PixelsToMeters(Shape.Thickness / 2.0f),
+				b2Vec2(Physics.PixelsToMeters(Midpoint.x), Physics.PixelsToMeters(Midpoint.y)),
+				std::atan2(Delta.y, Delta.x)
+			);
+
+			FixtureDef.shape = &BoxShape;
+			Body->CreateFixture(&FixtureDef);
+		}
+
+		LOG("[LevelGeometry] Created {} static shapes on one body", GetShapeCount());
+	}
+
+	void LevelGeometry::EndPlay()
+	{
+		if (Body)
+		{
+			GetWorld().GetPhysics().MarkForDestruction(Body);
+			Body = nullptr;
+		}
+		Actor::EndPlay();
+	}
+}
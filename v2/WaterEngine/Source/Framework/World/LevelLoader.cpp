@@ -0,0 +1,421 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/LevelLoader.h"
+#include "Framework/World/LevelGeometry.h"
+#include "Subsystem/ResourceSubsystem.h"
+#include "Subsystem/NavigationSubsystem.h"
+#include "Utility/JobSystem.h"
+#include "Utility/Log.h"
+
+#include <filesystem>
+
+#ifdef USE_PACKED_ASSETS
+#include <physfs.h>
+#endif
+
+namespace we
+{
+	namespace
+	{
+		string ReadWholeFile(const string& Path)
+		{
+			std::ifstream In(Path, std::ios::binary);
+			if (!In) return {};
+			return string(std::istreambuf_iterator<char>(In), std::istreambuf_iterator<char>());
+		}
+
+		string GetSourcePath(const string& CookedPath)
+		{
+			return std::filesystem::path(CookedPath).replace_extension(".json").string();
+		}
+	}
+
+	void LevelLoader::RegisterActorType(const string& Type, ActorFactory Factory)
+	{
+		Factories[Type] = std::move(Factory);
+	}
+
+	bool LevelLoader::Load(World& InWorld, const string& Path)
+	{
+		clock Timer;
+
+		auto Loaded = ReadLevel(Path);
+		if (!Loaded)
+		{
+			ERROR("[Level] Failed to load {}", Path);
+			return false;
+		}
+
+		LoadedWorld = &InWorld;
+		Level = std::move(*Loaded);
+		Instantiate(InWorld, false);
+
+		// Barriers and geometry create their bodies when they begin play, before the next navigation tick
+		InWorld.GetNavigation().RequestBake();
+
+		LOG("[Level] Loaded {}: {} props, {} barriers, {} actors in {:.2f} ms", Path,
+			Level.Props.size(), Level.Barriers.size(), Level.Actors.size(),
+			Timer.getElapsedTime().asSeconds() * 1000.0f);
+		return true;
+	}
+
+	bool LevelLoader::LoadStreamed(World& InWorld, const string& Path)
+	{
+		clock Timer;
+
+		auto Loaded = ReadLevel(Path);
+		if (!Loaded)
+		{
+			ERROR("[Level] Failed to load {}", Path);
+			return false;
+		}
+
+		LoadedWorld = &InWorld;
+		Level = std::move(*Loaded);
+		Instantiate(InWorld, true);
+
+		CellContents.clear();
+		for (uint i = 0; i < Level.Props.size(); ++i)
+		{
+			if (!Level.Props[i].bPersistent)
+			{
+				CellContents[WorldPartition::GetCellKey(Level.Props[i].Position)].Props.push_back(i);
+			}
+		}
+		for (uint i = 0; i < Level.Actors.size(); ++i)
+		{
+			if (!Level.Actors[i].bPersistent)
+			{
+				CellContents[WorldPartition::GetCellKey(Level.Actors[i].Position)].Actors.push_back(i);
+			}
+		}
+
+		vector<int64> Cells;
+		Cells.reserve(CellContents.size());
+		for (const auto& [Key, Content] : CellContents)
+		{
+			Cells.push_back(Key);
+		}
+		InWorld.GetPartition().Enable(*this, Cells);
+		InWorld.GetNavigation().RequestBake();
+
+		LOG("[Level] Loaded {} for streaming: {} props, {} actors in {} cells in {:.2f} ms", Path,
+			Level.Props.size(), Level.Actors.size(), Cells.size(),
+			Timer.getElapsedTime().asSeconds() * 1000.0f);
+		return true;
+	}
+
+	optional<LevelData> LevelLoader::ReadLevel(const string& Path)
+	{
+		#ifdef USE_RAW_ASSETS
+			// Cooked into the build tree; the source Content folder only ever holds authored files
+			const string CookedPath = COOKED_CONTENT_PATH + Path;
+			const string SourcePath = GetSourcePath(ASSET_ROOT_PATH + Path);
+
+			std::error_code Error;
+			if (std::filesystem::exists(SourcePath, Error))
+			{
+				std::filesystem::create_directories(std::filesystem::path(CookedPath).parent_path(), Error);
+				const bool bStale = !std::filesystem::exists(CookedPath, Error)
+					|| std::filesystem::last_write_time(SourcePath, Error) > std::filesystem::last_write_time(CookedPath, Error)
+					|| !LevelData::IsCurrentBinary(ReadWholeFile(CookedPath));
+				if (bStale && !Cook(SourcePath, CookedPath))
+					return std::nullopt;
+			}
+
+			return LevelData::FromBinary(ReadWholeFile(CookedPath));
+		#else
+			if (PHYSFS_exists(Path.c_str()))
+			{
+				const string Bytes = LoadAsset().LoadFileData(Path);
+				if (LevelData::IsCurrentBinary(Bytes))
+					return LevelData::FromBinary(Bytes);
+			}
+
+			const string SourcePath = GetSourcePath(Path);
+			WARNING("[Level] {} was not cooked for this build, parsing {} instead", Path, SourcePath);
+			return LevelData::FromJson(LoadAsset().LoadFileData(SourcePath));
+		#endif
+	}
+
+	bool LevelLoader::Cook(const string& SourcePath, const string& CookedPath)
+	{
+		const string Text = ReadWholeFile(SourcePath);
+		if (Text.empty())
+		{
+			ERROR("[Level] Failed to read {}", SourcePath);
+			return false;
+		}
+
+		auto Level = LevelData::FromJson(Text);
+		if (!Level) return false;
+
+		const string Bytes = Level->ToBinary();
+		std::ofstream Out(CookedPath, std::ios::binary | std::ios::trunc);
+		if (!Out || !Out.write(Bytes.data(), Bytes.size()))
+		{
+			ERROR("[Level] Failed to write {}", CookedPath);
+			return false;
+		}
+
+		LOG("[Level] Cooked {} ({} bytes)", CookedPath, Bytes.size());
+		return true;
+	}
+
+	void LevelLoader::Instantiate(World& InWorld, bool bStreamed)
+	{
+		Textures.assign(Level.Strings.size(), {});
+		PersistentTextures.clear();
+		Decoding.clear();
+		NamedActors.clear();
+		SpawnPoints.clear();
+
+		// Resolve every texture once, in one pass, before any actor is spawned
+		ulong ActorCount = 1 + Level.Actors.size();
+		ulong CircleCount = 0;
+		ulong SegmentCount = 0;
+
+		for (const auto& Prop : Level.Props)
+		{
+			if (Prop.CollisionRadius > 0.0f) ++CircleCount;
+			if (bStreamed && !Prop.bPersistent) continue;
+
+			ResolveTexture(Prop.Texture);
+			ResolveTexture(Prop.Shadow);
+			ActorCount += 2;
+		}
+		for (const auto& Line : Level.Barriers)
+		{
+			if (Line.PointCount < 2) continue;
+			SegmentCount += Line.bClosed ? Line.PointCount : Line.PointCount - 1;
+		}
+
+		InWorld.ReserveActors(ActorCount);
+
+		auto Geometry = InWorld.SpawnActor<LevelGeometry>().lock();
+		Geometry->Reserve(CircleCount, SegmentCount);
+
+		// Collision of streamed props stays too: persistent actors walk through unloaded cells,
+		// and navigation is baked against the whole level rather than what happens to be loaded
+		for (const auto& Prop : Level.Props)
+		{
+			if (Prop.CollisionRadius > 0.0f)
+			{
+				Geometry->AddCircle(Prop.Position + Prop.CollisionOffset, Prop.CollisionRadius);
+			}
+			if (!bStreamed || Prop.bPersistent)
+			{
+				SpawnProp(Prop, nullptr);
+			}
+		}
+
+		for (const auto& Line : Level.Barriers)
+		{
+			if (static_cast<ulong>(Line.FirstPoint) + Line.PointCount > Level.Points.size())
+			{
+				ERROR("[Level] Barrier points out of range");
+				continue;
+			}
+			Geometry->AddPolyline(Level.Points.data() + Line.FirstPoint, Line.PointCount, Line.bClosed, Line.Thickness);
+		}
+
+		for (const auto& Placed : Level.Actors)
+		{
+			if (!bStreamed || Placed.bPersistent)
+			{
+				SpawnLevelActor(Placed);
+			}
+		}
+
+		for (const auto& Spawn : Level.Spawns)
+		{
+			SpawnPoints[Level.GetString(Spawn.Name)] = Spawn.Position;
+		}
+	}
+
+	bool LevelLoader::PrefetchCell(int64 Cell)
+	{
+		auto It = CellContents.find(Cell);
+		if (It == CellContents.end()) return true;
+
+		CellContent& Content = It->second;
+		bool bReady = true;
+		for (uint Index : Content.Props)
+		{
+			bReady &= RequireTexture(Level.Props[Index].Texture, Content);
+			bReady &= RequireTexture(Level.Props[Index].Shadow, Content);
+		}
+		return bReady;
+	}
+
+	void LevelLoader::LoadCell(int64 Cell, vector<weak<Actor>>& OutActors)
+	{
+		auto It = CellContents.find(Cell);
+		if (It == CellContents.end() || !LoadedWorld) return;
+
+		const CellContent& Content = It->second;
+		LoadedWorld->ReserveActors(Content.Props.size() * 2 + Content.Actors.size());
+
+		for (uint Index : Content.Props)
+		{
+			SpawnProp(Level.Props[Index], &OutActors);
+		}
+		for (uint Index : Content.Actors)
+		{
+			if (auto Spawned = SpawnLevelActor(Level.Actors[Index]))
+			{
+				OutActors.push_back(Spawned);
+			}
+		}
+	}
+
+	void LevelLoader::UnloadCell(int64 Cell)
+	{
+		auto It = CellContents.find(Cell);
+		if (It == CellContents.end()) return;
+
+		// The resource cache lets go of textures no other cell holds on its next collection
+		It->second.Textures.clear();
+		for (uint Index : It->second.Props)
+		{
+			Decoding.erase(Level.Props[Index].Texture);
+			Decoding.erase(Level.Props[Index].Shadow);
+		}
+	}
+
+	void LevelLoader::ResolveTexture(LevelString Index)
+	{
+		if (Index < 0 || Index >= static_cast<LevelString>(Textures.size()) || !Textures[Index].expired())
+			return;
+
+		if (auto Loaded = LoadAsset().LoadTexture(Level.GetString(Index)))
+		{
+			Textures[Index] = Loaded;
+			PersistentTextures.push_back(std::move(Loaded));
+		}
+	}
+
+	bool LevelLoader::RequireTexture(LevelString Index, CellContent& Content)
+	{
+		if (Index < 0 || Index >= static_cast<LevelString>(Textures.size()))
+			return true;
+
+		auto Hold = [&Content](shared<texture> Held)
+		{
+			for (const auto& Existing : Content.Textures)
+			{
+				if (Existing == Held) return;
+			}
+			Content.Textures.push_back(std::move(Held));
+		};
+
+		if (auto Resident = Textures[Index].lock())
+		{
+			Hold(std::move(Resident));
+			return true;
+		}
+
+		// Reading and decoding the file is the slow part and runs on a job worker;
+		// only the upload, which needs this thread, is left for the prefetch step
+		auto& Pending = Decoding[Index];
+		if (!Pending)
+		{
+			Pending = make_shared<ImageDecode>();
+			GetJobs().Enqueue([Pending, Name = Level.GetString(Index)]()
+			{
+				Pending->Decoded = LoadAsset().DecodeImage(Name);
+				Pending->bDone.store(true, std::memory_order_release);
+			});
+			return false;
+		}
+		if (!Pending->bDone.load(std::memory_order_acquire))
+			return false;
+
+		const string& Name = Level.GetString(Index);
+		shared<texture> Uploaded = Pending->Decoded ? LoadAsset().LoadTexture(Name, *Pending->Decoded) : nullptr;
+		Decoding.erase(Index);
+		if (!Uploaded)
+		{
+			// Not worth retrying every frame; the prop spawns without this sprite
+			ERROR("[Level] Failed to load texture {}", Name);
+			return true;
+		}
+
+		Textures[Index] = Uploaded;
+		Hold(std::move(Uploaded));
+		return true;
+	}
+
+	void LevelLoader::SpawnProp(const LevelProp& Prop, vector<weak<Actor>>* OutActors)
+	{
+		auto SpawnSprite = [&](LevelString Index, optional<float> Depth)
+		{
+			if (Index < 0 || Index >= static_cast<LevelString>(Textures.size()))
+				return;
+
+			auto Texture = Textures[Index].lock();
+			if (!Texture)
+				return;
+
+			auto Sprite = LoadedWorld->SpawnActor<Actor>().lock();
+			Sprite->SetSprite(Texture);
+			Sprite->SetSpriteOrigin(Prop.Origin);
+			Sprite->SetPosition(Prop.Position);
+			if (Depth) Sprite->SetCustomRenderDepth(*Depth);
+
+			// Props never move, so they are drawn from the static layer cache
+			Sprite->SetStatic(true);
+
+			if (OutActors) OutActors->push_back(Sprite);
+		};
+
+		SpawnSprite(Prop.Texture, Prop.bHasDepth ? optional<float>{Prop.Depth} : std::nullopt);
+		SpawnSprite(Prop.Shadow, Prop.ShadowDepth);
+	}
+
+	shared<Actor> LevelLoader::SpawnLevelActor(const LevelActor& Placed)
+	{
+		const string& Type = Level.GetString(Placed.Type);
+		auto Factory = Factories.find(Type);
+		if (Factory == Factories.end())
+		{
+			WARNING("[Level] No actor type registered as '{}'", Type);
+			return nullptr;
+		}
+		if (static_cast<ulong>(Placed.FirstWaypoint) + Placed.WaypointCount > Level.Points.size())
+		{
+			ERROR("[Level] Waypoints of '{}' out of range", Type);
+			return nullptr;
+		}
+
+		LevelActorSpawn Spawn;
+		Spawn.Name = Level.GetString(Placed.Name);
+		Spawn.Position = Placed.Position;
+		Spawn.Waypoints.assign(Level.Points.begin() + Placed.FirstWaypoint,
+			Level.Points.begin() + Placed.FirstWaypoint + Placed.WaypointCount);
+
+		auto Spawned = Factory->second(*LoadedWorld, Spawn);
+		if (Spawned && !Spawn.Name.empty())
+		{
+			NamedActors[Spawn.Name] = Spawned;
+		}
+		return Spawned;
+	}
+
+	optional<vec2f> LevelLoader::FindSpawnPoint(const string& Name) const
+	{
+		auto It = SpawnPoints.find(Name);
+		if (It == SpawnPoints.end()) return std::nullopt;
+		return It->second;
+	}
+
+	shared<Actor> LevelLoader::FindActor(const string& Name) const
+	{
+		auto It = NamedActors.find(Name);
+		if (It == NamedActors.end()) return nullptr;
+		return It->second.lock();
+	}
+}
@@ -19,7 +19,10 @@ namespace we
 
 	void Object::Destroy()
 	{
+		if (bIsPendingDestroy) return;
+
 		bIsPendingDestroy = true;
+		OnPendingDestroy();
 	}
 
 	bool Object::IsPendingDestroy() const
@@ -0,0 +1,84 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/SignificanceManager.h"
+#include "Framework/World/Actor.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Math.h"
+
+#include <cmath>
+
+namespace we
+{
+	void SignificanceManager::BeginFrame(const rectf& InViewBounds)
+	{
+		ViewBounds = InViewBounds;
+		Due.clear();
+		Stats = {};
+	}
+
+	bool SignificanceManager::Evaluate(Actor& InActor, float DeltaTime, float& OutDeltaTime)
+	{
+		const float Distance = GetDistanceToView(InActor.GetPosition());
+		InActor.bIsInView = InActor.IsVisible() && Distance <= WEConfig.World.SignificanceViewMargin;
+
+		if (InActor.bAlwaysRelevant || InActor.bIsInView)
+		{
+			// Includes any time accumulated while the actor was throttled
+			OutDeltaTime = InActor.TickAccumulator + DeltaTime;
+			InActor.TickAccumulator = 0.0f;
+			++Stats.FullRate;
+			return true;
+		}
+
+		InActor.TickAccumulator += DeltaTime;
+		if (InActor.TickAccumulator >= GetTickInterval(Distance))
+		{
+			Due.emplace_back(&InActor, InActor.TickAccumulator);
+		}
+		else
+		{
+			++Stats.Skipped;
+		}
+		return false;
+	}
+
+	ulong SignificanceManager::PrepareThrottledTicks()
+	{
+		std::sort(Due.begin(), Due.end(), [](const auto& A, const auto& B) { return A.second > B.second; });
+
+		const ulong Budget = WEConfig.World.MaxThrottledTicksPerFrame;
+		const ulong Count = Budget == 0 ? Due.size() : Min<ulong>(Budget, Due.size());
+
+		// Deferred actors keep their time, so they sort ahead of the rest next frame
+		for (ulong i = 0; i < Count; ++i)
+		{
+			Due[i].first->TickAccumulator = 0.0f;
+		}
+
+		Stats.Throttled = static_cast<uint>(Count);
+		Stats.Deferred = static_cast<uint>(Due.size() - Count);
+		return Count;
+	}
+
+	float SignificanceManager::GetTickInterval(float Distance) const
+	{
+		const auto& Distances = WEConfig.World.SignificanceDistances;
+
+		ulong Tier = 0;
+		while (Tier < Distances.size() && Distance > Distances[Tier])
+		{
+			++Tier;
+		}
+		return WEConfig.World.SignificanceTickIntervals[Tier];
+	}
+
+	float SignificanceManager::GetDistanceToView(vec2f Position) const
+	{
+		const float DX = std::max({ ViewBounds.position.x - Position.x, 0.0f, Position.x - (ViewBounds.position.x + ViewBounds.size.x) });
+		const float DY = std::max({ ViewBounds.position.y - Position.y, 0.0f, Position.y - (ViewBounds.position.y + ViewBounds.size.y) });
+		return std::sqrt(DX * DX + DY * DY);
+	}
+}
@@ -0,0 +1,336 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/TaskScheduler.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Log.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace we
+{
+	namespace
+	{
+		// Free lists per size class, carved from large blocks that are kept for reuse.
+		// Frames bigger than the largest class go to the heap
+		class TaskFrameArena
+		{
+		public:
+			void* Allocate(ulong Size)
+			{
+				const int Class = GetClass(Size);
+				if (Class < 0) return ::operator new(Size);
+
+				if (FreeNode* Node = FreeLists[Class])
+				{
+					FreeLists[Class] = Node->Next;
+					return Node;
+				}
+
+				const ulong ClassSize = SizeClasses[Class];
+				if (Remaining[Class] < ClassSize)
+				{
+					Blocks.push_back(make_unique<std::byte[]>(BlockSize));
+					Cursors[Class] = Blocks.back().get();
+					Remaining[Class] = BlockSize;
+				}
+
+				void* Memory = Cursors[Class];
+				Cursors[Class] += ClassSize;
+				Remaining[Class] -= ClassSize;
+				return Memory;
+			}
+
+			void Free(void* Memory, ulong Size)
+			{
+				const int Class = GetClass(Size);
+				if (Class < 0)
+				{
+					::operator delete(Memory);
+					return;
+				}
+
+				FreeNode* Node = static_cast<FreeNode*>(Memory);
+				Node->Next = FreeLists[Class];
+				FreeLists[Class] = Node;
+			}
+
+		private:
+			struct FreeNode
+			{
+				FreeNode* Next;
+			};
+
+			// Multiples of the default new alignment, so every slot is aligned like operator new
+			static constexpr ulong ClassCount = 5;
+			static constexpr array<ulong, ClassCount> SizeClasses{ 128, 256, 512, 1024, 2048 };
+			static constexpr ulong BlockSize = 64 * 1024;
+
+			static int GetClass(ulong Size)
+			{
+				for (ulong i = 0; i < ClassCount; ++i)
+				{
+					if (Size <= SizeClasses[i]) return static_cast<int>(i);
+				}
+				return -1;
+			}
+
+		private:
+			array<FreeNode*, ClassCount> FreeLists{};
+			array<std::byte*, ClassCount> Cursors{};
+			array<ulong, ClassCount> Remaining{};
+			vector<unique<std::byte[]>> Blocks;
+		};
+
+		TaskFrameArena& GetFrameArena()
+		{
+			static TaskFrameArena Arena;
+			return Arena;
+		}
+	}
+
+	void GameTask::promise_type::unhandled_exception()
+	{
+		ERROR("[Task] Unhandled exception, task ended");
+	}
+
+	void* GameTask::promise_type::operator new(ulong Size)
+	{
+		return GetFrameArena().Allocate(Size);
+	}
+
+	void GameTask::promise_type::operator delete(void* Memory, ulong Size)
+	{
+		GetFrameArena().Free(Memory, Size);
+	}
+
+	GameTask& GameTask::operator=(GameTask&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			if (Coroutine) Coroutine.destroy();
+			Coroutine = std::exchange(Other.Coroutine, {});
+		}
+		return *this;
+	}
+
+	GameTask::~GameTask()
+	{
+		if (Coroutine)
+		{
+			Coroutine.destroy();
+		}
+	}
+
+	TaskScheduler::~TaskScheduler()
+	{
+		for (auto& Task : Slots)
+		{
+			if (Task.Coroutine)
+			{
+				Task.Coroutine.destroy();
+			}
+		}
+	}
+
+	TaskHandle TaskScheduler::Start(weak<Object> Owner, GameTask Task)
+	{
+		if (!Task.Coroutine) return {};
+
+		uint Slot = 0;
+		if (!FreeSlots.empty())
+		{
+			Slot = FreeSlots.back();
+			FreeSlots.pop_back();
+		}
+		else
+		{
+			Slot = static_cast<uint>(Slots.size());
+			Slots.emplace_back();
+		}
+
+		TaskSlot& Entry = Slots[Slot];
+		Entry.Coroutine = std::exchange(Task.Coroutine, {});
+		Entry.Owner = std::move(Owner);
+		Entry.Coroutine.promise().Scheduler = this;
+		Entry.Coroutine.promise().Slot = Slot;
+		++LiveCount;
+
+		const TaskHandle Handle{ Slot, Entry.Generation };
+		Resume(Slot, Entry.Generation);
+		return Handle;
+	}
+
+	void TaskScheduler::Cancel(TaskHandle Handle)
+	{
+		if (!IsCurrent(Handle.Slot, Handle.Generation)) return;
+
+		// A task cancelled from inside its own run is destroyed once it suspends
+		if (Slots[Handle.Slot].bRunning)
+		{
+			Slots[Handle.Slot].bCancelled = true;
+			return;
+		}
+		Release(Handle.Slot);
+	}
+
+	bool TaskScheduler::IsRunning(TaskHandle Handle) const
+	{
+		return IsCurrent(Handle.Slot, Handle.Generation) && !Slots[Handle.Slot].bCancelled;
+	}
+
+	void TaskScheduler::Tick(float DeltaTime)
+	{
+		Time += DeltaTime;
+		++Frame;
+
+		auto LaterTime = [](const TimedWake& A, const TimedWake& B) { return A.Time > B.Time; };
+		while (!Sleeping.empty() && Sleeping.front().Time <= Time)
+		{
+			std::pop_heap(Sleeping.begin(), Sleeping.end(), LaterTime);
+			Ready.push_back({ Sleeping.back().Slot, Sleeping.back().Generation });
+			Sleeping.pop_back();
+		}
+
+		auto LaterFrame = [](const FrameWake& A, const FrameWake& B) { return A.Frame > B.Frame; };
+		while (!FrameSleeping.empty() && FrameSleeping.front().Frame <= Frame)
+		{
+			std::pop_heap(FrameSleeping.begin(), FrameSleeping.end(), LaterFrame);
+			Ready.push_back({ FrameSleeping.back().Slot, FrameSleeping.back().Generation });
+			FrameSleeping.pop_back();
+		}
+
+		// Conditions may touch their owner, so tasks of destroyed owners are dropped first
+		ulong Kept = 0;
+		for (ulong i = 0; i < Polling.size(); ++i)
+		{
+			const PollWait Wait = Polling[i];
+			if (!IsCurrent(Wait.Slot, Wait.Generation)) continue;
+
+			if (!HasLiveOwner(Wait.Slot))
+			{
+				Release(Wait.Slot);
+				continue;
+			}
+
+			if (Wait.Test(Wait.Context))
+			{
+				Ready.push_back({ Wait.Slot, Wait.Generation });
+			}
+			else
+			{
+				Polling[Kept++] = Wait;
+			}
+		}
+		Polling.resize(Kept);
+
+		clock Timer;
+		bool bFirstLoad = true;
+		while (NextAssetLoad < AssetLoads.size())
+		{
+			if (!bFirstLoad && Timer.getElapsedTime().asSeconds() * 1000.0f >= WEConfig.World.TaskAssetBudgetMs)
+				break;
+
+			const LoadWait Wait = AssetLoads[NextAssetLoad++];
+			if (!IsCurrent(Wait.Slot, Wait.Generation)) continue;
+
+			if (!HasLiveOwner(Wait.Slot))
+			{
+				Release(Wait.Slot);
+				continue;
+			}
+
+			Wait.Load(Wait.Context);
+			bFirstLoad = false;
+			Ready.push_back({ Wait.Slot, Wait.Generation });
+		}
+		if (NextAssetLoad == AssetLoads.size())
+		{
+			AssetLoads.clear();
+			NextAssetLoad = 0;
+		}
+
+		// Tasks that wait again while resuming land in the lists above, never in Ready
+		for (ulong i = 0; i < Ready.size(); ++i)
+		{
+			Resume(Ready[i].first, Ready[i].second);
+		}
+		Ready.clear();
+	}
+
+	void TaskScheduler::SleepFor(uint Slot, float Seconds)
+	{
+		Sleeping.push_back({ Time + Seconds, Slot, Slots[Slot].Generation });
+		std::push_heap(Sleeping.begin(), Sleeping.end(), [](const TimedWake& A, const TimedWake& B) { return A.Time > B.Time; });
+	}
+
+	void TaskScheduler::SleepFrames(uint Slot, uint Frames)
+	{
+		FrameSleeping.push_back({ Frame + Frames, Slot, Slots[Slot].Generation });
+		std::push_heap(FrameSleeping.begin(), FrameSleeping.end(), [](const FrameWake& A, const FrameWake& B) { return A.Frame > B.Frame; });
+	}
+
+	void TaskScheduler::PollUntil(uint Slot, void* Context, bool (*Test)(void*))
+	{
+		Polling.push_back({ Slot, Slots[Slot].Generation, Context, Test });
+	}
+
+	void TaskScheduler::LoadFor(uint Slot, void* Context, void (*Load)(void*))
+	{
+		AssetLoads.push_back({ Slot, Slots[Slot].Generation, Context, Load });
+	}
+
+	void TaskScheduler::Resume(uint Slot, uint Generation)
+	{
+		if (!IsCurrent(Slot, Generation)) return;
+
+		// Held so the owner outlives this run even if the task destroys it
+		auto Owner = Slots[Slot].Owner.lock();
+		if (!Owner || Owner->IsPendingDestroy())
+		{
+			Release(Slot);
+			return;
+		}
+
+		const GameTask::Handle Coroutine = Slots[Slot].Coroutine;
+		Slots[Slot].bRunning = true;
+		Coroutine.resume();
+
+		// Indexed again, since tasks started during the run may have grown Slots
+		Slots[Slot].bRunning = false;
+		if (Coroutine.done() || Slots[Slot].bCancelled)
+		{
+			Release(Slot);
+		}
+	}
+
+	void TaskScheduler::Release(uint Slot)
+	{
+		TaskSlot& Entry = Slots[Slot];
+		const GameTask::Handle Coroutine = std::exchange(Entry.Coroutine, {});
+		Entry.Owner.reset();
+		Entry.bCancelled = false;
+
+		// Wake entries still queued for this slot go stale
+		++Entry.Generation;
+		FreeSlots.push_back(Slot);
+		--LiveCount;
+
+		// Last, as destroying the frame runs destructors that may start or cancel tasks
+		Coroutine.destroy();
+	}
+
+	bool TaskScheduler::IsCurrent(uint Slot, uint Generation) const
+	{
+		return Slot < Slots.size() && Slots[Slot].Generation == Generation && Slots[Slot].Coroutine;
+	}
+
+	bool TaskScheduler::HasLiveOwner(uint Slot) const
+	{
+		auto Owner = Slots[Slot].Owner.lock();
+		return Owner && !Owner->IsPendingDestroy();
+	}
+}
@@ -5,12 +5,18 @@
 
 #include "Framework/World/World.h"
 #include "Framework/World/Actor.h"
+#include "Subsystem/PhysicsSubsystem.h"
+#include "Subsystem/NavigationSubsystem.h"
+#include "Subsystem/CameraSubsystem.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Log.h"
 
 namespace we
 {
 	World::World(WorldSubsystem& Subsystem)
 		: Subsystem{Subsystem}
 		, bHasBegunPlay{false}
+		, FrameNumber{0}
 		, PendingActors{}
 		, Actors{}
 	{
@@ -31,14 +37,241 @@ namespace we
 		return nullptr;
 	}
 
+	void World::LoadSoundBank(vector<string> InSounds, bool bCompact)
+	{
+		Sounds = SoundBank(std::move(InSounds), bCompact);
+		Sounds.Load();
+	}
+
+	void World::ReserveActors(ulong Count)
+	{
+		PendingActors.reserve(PendingActors.size() + Count);
+		Actors.reserve(Actors.size() + PendingActors.size() + Count);
+		ActorByID.reserve(ActorByID.size() + PendingActors.size() + Count);
+	}
+
+	WorldSnapshot World::CaptureSnapshot() const
+	{
+		WorldSnapshot Snapshot;
+		SnapshotWriter Out(Snapshot.Data);
+
+		auto CaptureActor = [&](const shared<Actor>& Captured)
+		{
+			if (!Captured->IsSnapshotEnabled() || Captured->IsPendingDestroy())
+				return;
+
+			Out.Write(Captured->GetID());
+			Out.Write(Captured->GetActorType());
+			const ulong SizeOffset = Out.GetSize();
+			Out.Write(uint{0});
+
+			const ulong PayloadStart = Out.GetSize();
+			Captured->SaveState(Out);
+			const uint PayloadSize = static_cast<uint>(Out.GetSize() - PayloadStart);
+			std::memcpy(Snapshot.Data.data() + SizeOffset, &PayloadSize, sizeof(PayloadSize));
+
+			++Snapshot.ActorCount;
+		};
+
+		for (const auto& Captured : Actors)
+		{
+			CaptureActor(Captured);
+		}
+		for (const auto& Captured : PendingActors)
+		{
+			CaptureActor(Captured);
+		}
+
+		return Snapshot;
+	}
+
+	bool World::RestoreSnapshot(const WorldSnapshot& Snapshot)
+	{
+		auto FindAnyActor = [this](ActorID ID) -> Actor*
+		{
+			if (Actor* Found = FindActor(ID))
+				return Found;
+
+			for (const auto& Pending : PendingActors)
+			{
+				if (Pending->GetID() == ID)
+					return Pending.get();
+			}
+			return nullptr;
+		};
+
+		set<ActorID> Restored;
+		uint Respawned = 0;
+		uint Missing = 0;
+		bool bSucceeded = true;
+
+		SnapshotReader In(Snapshot.Data.data(), Snapshot.Data.size());
+		for (uint i = 0; i < Snapshot.ActorCount; ++i)
+		{
+			ActorID ID = INVALID_ACTOR_ID;
+			TypeID Type = INVALID_TYPE_ID;
+			uint PayloadSize = 0;
+			if (!In.Read(ID) || !In.Read(Type) || !In.Read(PayloadSize))
+			{
+				ERROR("[World] Snapshot is truncated");
+				bSucceeded = false;
+				break;
+			}
+
+			auto Block = In.ReadBlock(PayloadSize);
+			if (!Block)
+			{
+				ERROR("[World] Snapshot is truncated");
+				bSucceeded = false;
+				break;
+			}
+
+			auto Respawn = SnapshotRespawns.find(ID);
+			Actor* Target = FindAnyActor(Respawn != SnapshotRespawns.end() ? Respawn->second : ID);
+			if (!Target || Target->IsPendingDestroy() || !Target->IsSnapshotEnabled())
+			{
+				auto Factory = SnapshotFactories.find(Type);
+				if (Factory == SnapshotFactories.end())
+				{
+					++Missing;
+					continue;
+				}
+
+				// Joins play with the other pending actors, already holding its restored state
+				Target = Factory->second().get();
+				SnapshotRespawns[ID] = Target->GetID();
+				++Respawned;
+			}
+
+			Target->LoadState(*Block);
+			if (!Block->IsValid() || !Block->IsAtEnd())
+			{
+				WARNING("[World] Snapshot state of actor {} does not match its layout", ID);
+				bSucceeded = false;
+			}
+			Restored.insert(Target->GetID());
+		}
+
+		// Opted-in actors that did not exist at capture time
+		uint Removed = 0;
+		auto RemoveIfNew = [&](const shared<Actor>& Candidate)
+		{
+			if (Candidate->IsSnapshotEnabled() && !Candidate->IsPendingDestroy() && !Restored.contains(Candidate->GetID()))
+			{
+				Candidate->Destroy();
+				++Removed;
+			}
+		};
+		for (const auto& Candidate : Actors)
+		{
+			RemoveIfNew(Candidate);
+		}
+		for (const auto& Candidate : PendingActors)
+		{
+			RemoveIfNew(Candidate);
+		}
+
+		GetPhysics().RebuildQueuedBodies();
+
+		if (Missing > 0)
+		{
+			WARNING("[World] {} snapshot actors no longer exist and were not restored", Missing);
+		}
+		LOG("[World] Restored {} actors, respawned {}, removed {} ({} bytes)", Restored.size(), Respawned, Removed, Snapshot.GetMemoryUsage());
+
+		return bSucceeded;
+	}
+
 	void World::RegisterActor(ActorID ID, shared<Actor> Actor)
 	{
-		ActorByID[ID] = Actor;
+		const TypeID Type = Actor->ConcreteType;
+		if (ActorsByType.size() <= Type)
+		{
+			ActorsByType.resize(Type + 1);
+		}
+		Actor->TypeListIndex = static_cast<uint>(ActorsByType[Type].size());
+		ActorsByType[Type].push_back(Actor.get());
+
+		for (uint Tag = 0; Tag < MAX_ACTOR_TAGS; ++Tag)
+		{
+			if (Actor->Tags.test(Tag))
+			{
+				ActorsByTag[Tag].push_back(Actor.get());
+			}
+		}
+		Actor->bIndexed = true;
+
+		if (Actor->bIsStatic)
+		{
+			Actor->MarkRenderStateChanged();
+		}
+
+		ActorByID[ID] = std::move(Actor);
 	}
 
 	void World::UnregisterActor(ActorID ID)
 	{
-		ActorByID.erase(ID);
+		auto It = ActorByID.find(ID);
+		if (It == ActorByID.end())
+			return;
+
+		Actor& Removed = *It->second;
+		Removed.bIndexed = false;
+
+		// Swap-remove, moving the type's last actor into the freed slot
+		auto& TypeList = ActorsByType[Removed.ConcreteType];
+		Actor* Last = TypeList.back();
+		TypeList[Removed.TypeListIndex] = Last;
+		Last->TypeListIndex = Removed.TypeListIndex;
+		TypeList.pop_back();
+
+		for (uint Tag = 0; Tag < MAX_ACTOR_TAGS; ++Tag)
+		{
+			if (Removed.Tags.test(Tag))
+			{
+				UpdateTagIndex(Removed, Tag, false);
+			}
+		}
+
+		ActorByID.erase(It);
+	}
+
+	void World::UpdateTagIndex(Actor& Tagged, uint Tag, bool bAdded)
+	{
+		auto& TagList = ActorsByTag[Tag];
+		if (bAdded)
+		{
+			TagList.push_back(&Tagged);
+			return;
+		}
+
+		auto Found = std::find(TagList.begin(), TagList.end(), &Tagged);
+		if (Found != TagList.end())
+		{
+			*Found = TagList.back();
+			TagList.pop_back();
+		}
+	}
+
+	void World::QueueStaticChange(ActorID ID)
+	{
+		// Nothing would ever take them
+		if (!WEConfig.Render.bStaticLayerCache) return;
+
+		StaticChanges.push_back(ID);
+	}
+
+	void World::TakeStaticChanges(vector<ActorID>& OutChanged)
+	{
+		for (ActorID ID : StaticChanges)
+		{
+			if (Actor* Changed = FindActor(ID))
+			{
+				Changed->bRenderStateQueued = false;
+			}
+		}
+		OutChanged.swap(StaticChanges);
+		StaticChanges.clear();
 	}
 
 	void World::StartPlay()
@@ -53,6 +286,14 @@ namespace we
 
 	void World::StartTick(float DeltaTime)
 	{
+		++FrameNumber;
+
+		// Before pending actors are flushed, so streamed-in actors begin play this frame
+		if (Partition.IsEnabled())
+		{
+			Partition.Update(GetCamera().GetViewPosition());
+		}
+
 		for (auto& A : PendingActors)
 		{
 			Actors.push_back(A);
@@ -62,16 +303,37 @@ namespace we
 
 		PendingActors.clear();
 
-		for (auto i = Actors.begin(); i != Actors.end();)
+		// Raised since the last tick, including contacts from the previous physics step
+		Events.Dispatch();
+
+		// Tasks woken now see this frame's new actors and act before the actors tick
+		Tasks.Tick(DeltaTime);
+
+		// Out-of-view actors tick less often the further they are from the camera
+		Significance.BeginFrame(Subsystem.GetCameraCullBounds());
+		for (auto& A : Actors)
 		{
-			i->get()->StartTick(DeltaTime);
-			++i;
+			float TickDelta = 0.0f;
+			if (Significance.Evaluate(*A, DeltaTime, TickDelta))
+			{
+				A->StartTick(TickDelta);
+			}
 		}
+		Significance.RunThrottledTicks([](Actor& Throttled, float Delta) { Throttled.StartTick(Delta); });
+
+		// Components of every actor that ticked, one type at a time
+		Components.TickSystems();
+
+		// Movement components queued their velocity; steer them around each other before physics sees it
+		Crowd.Resolve();
 
 		if (!IsPendingDestroy())
 		{
 			Tick(DeltaTime);
 		}
+
+		// Raised by this tick's actors and components, so listeners react before physics and rendering
+		Events.Dispatch();
 	}
 
 	void World::EndingPlay()
@@ -84,6 +346,12 @@ namespace we
 			}
 		}
 		EndPlay();
+
+		// The streaming source is usually owned by the derived world, which is about to go away
+		Partition.Reset();
+
+		// Paths and the grid belong to this world's collision
+		GetNavigation().Reset();
 	}
 
 	void World::GarbageCollection()
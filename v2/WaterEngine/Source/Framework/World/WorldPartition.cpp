@@ -0,0 +1,204 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Framework/World/WorldPartition.h"
+#include "Framework/World/Actor.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Log.h"
+
+#include <cmath>
+
+namespace we
+{
+	void WorldPartition::Enable(IStreamingSource& InSource, const vector<CellKey>& InCells)
+	{
+		Reset();
+		Source = &InSource;
+
+		Cells.reserve(InCells.size());
+		for (CellKey Key : InCells)
+		{
+			Cells.try_emplace(Key);
+		}
+
+		LOG("[World] Partition enabled with {} cells", Cells.size());
+	}
+
+	void WorldPartition::Reset()
+	{
+		Source = nullptr;
+		Cells.clear();
+		ActiveCells.clear();
+		LoadQueue.clear();
+		UnloadQueue.clear();
+		LoadedCount = 0;
+	}
+
+	void WorldPartition::Update(vec2f Focus)
+	{
+		if (!Source) return;
+
+		QueueCells(Focus);
+		ProcessQueues();
+	}
+
+	void WorldPartition::QueueCells(vec2f Focus)
+	{
+		const float CellSize = WEConfig.World.StreamingCellSize;
+		const float LoadRadius = WEConfig.World.StreamingLoadRadius;
+		const float UnloadRadius = LoadRadius + WEConfig.World.StreamingUnloadHysteresis;
+
+		// Only the cells around the focus are visited, so cost doesn't grow with the level
+		const int MinX = static_cast<int>(std::floor((Focus.x - LoadRadius) / CellSize));
+		const int MaxX = static_cast<int>(std::floor((Focus.x + LoadRadius) / CellSize));
+		const int MinY = static_cast<int>(std::floor((Focus.y - LoadRadius) / CellSize));
+		const int MaxY = static_cast<int>(std::floor((Focus.y + LoadRadius) / CellSize));
+
+		for (int Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int X = MinX; X <= MaxX; ++X)
+			{
+				const CellKey Key = (static_cast<int64>(X) << 32) | static_cast<uint>(Y);
+				auto It = Cells.find(Key);
+				if (It == Cells.end() || GetDistanceToCell(Focus, Key) > LoadRadius)
+					continue;
+
+				// A loaded cell waiting to unload becomes active again, which cancels the unload
+				ActiveCells.insert(Key);
+				if (It->second.State == ECellState::Unloaded)
+				{
+					It->second.State = ECellState::Queued;
+					LoadQueue.push_back(Key);
+				}
+			}
+		}
+
+		static vector<CellKey> Leaving;
+		Leaving.clear();
+		for (CellKey Key : ActiveCells)
+		{
+			if (GetDistanceToCell(Focus, Key) > UnloadRadius)
+			{
+				Leaving.push_back(Key);
+			}
+		}
+
+		for (CellKey Key : Leaving)
+		{
+			Cell& Leaver = Cells[Key];
+			if (Leaver.State == ECellState::Loaded)
+			{
+				UnloadQueue.push_back(Key);
+			}
+			else
+			{
+				// Never spawned; the stale load queue entry is skipped when it comes up
+				Leaver.State = ECellState::Unloaded;
+				Source->UnloadCell(Key);
+			}
+			ActiveCells.erase(Key);
+		}
+
+		// Nearest first, so what the player is about to see arrives before the rest
+		std::sort(LoadQueue.begin(), LoadQueue.end(), [Focus](CellKey A, CellKey B)
+		{
+			return GetDistanceToCell(Focus, A) < GetDistanceToCell(Focus, B);
+		});
+	}
+
+	void WorldPartition::ProcessQueues()
+	{
+		clock Timer;
+		bool bFirstStep = true;
+
+		auto HasBudget = [&]()
+		{
+			return bFirstStep || Timer.getElapsedTime().asSeconds() * 1000.0f < WEConfig.World.StreamingBudgetMs;
+		};
+
+		while (!UnloadQueue.empty() && HasBudget())
+		{
+			bFirstStep = false;
+			UnloadCell(UnloadQueue.back());
+			UnloadQueue.pop_back();
+		}
+
+		// Cells still waiting on their prefetch keep their place at the front
+		ulong Kept = 0;
+		ulong Next = 0;
+		while (Next < LoadQueue.size() && HasBudget())
+		{
+			bFirstStep = false;
+			const CellKey Key = LoadQueue[Next];
+			Cell& Loading = Cells[Key];
+
+			if (Loading.State == ECellState::Queued)
+			{
+				if (Source->PrefetchCell(Key))
+				{
+					Loading.State = ECellState::Prefetched;
+					continue;
+				}
+				LoadQueue[Kept++] = Key;
+			}
+			else if (Loading.State == ECellState::Prefetched)
+			{
+				Source->LoadCell(Key, Loading.Actors);
+				Loading.State = ECellState::Loaded;
+				++LoadedCount;
+			}
+			++Next;
+		}
+		LoadQueue.erase(LoadQueue.begin() + Kept, LoadQueue.begin() + Next);
+	}
+
+	void WorldPartition::UnloadCell(CellKey Key)
+	{
+		auto It = Cells.find(Key);
+		if (It == Cells.end() || It->second.State != ECellState::Loaded)
+			return;
+
+		// The cell may have streamed back in range while it waited in the queue
+		if (ActiveCells.contains(Key))
+			return;
+
+		for (auto& Weak : It->second.Actors)
+		{
+			if (auto Streamed = Weak.lock())
+			{
+				Streamed->Destroy();
+			}
+		}
+		It->second.Actors.clear();
+		It->second.State = ECellState::Unloaded;
+		--LoadedCount;
+
+		Source->UnloadCell(Key);
+	}
+
+	WorldPartition::CellKey WorldPartition::GetCellKey(vec2f Position)
+	{
+		const float CellSize = WEConfig.World.StreamingCellSize;
+		const int X = static_cast<int>(std::floor(Position.x / CellSize));
+		const int Y = static_cast<int>(std::floor(Position.y / CellSize));
+		return (static_cast<int64>(X) << 32) | static_cast<uint>(Y);
+	}
+
+	rectf WorldPartition::GetCellRect(CellKey Key)
+	{
+		const float CellSize = WEConfig.World.StreamingCellSize;
+		const int X = static_cast<int>(Key >> 32);
+		const int Y = static_cast<int>(static_cast<uint>(Key & 0xFFFFFFFF));
+		return rectf({ X * CellSize, Y * CellSize }, { CellSize, CellSize });
+	}
+
+	float WorldPartition::GetDistanceToCell(vec2f Focus, CellKey Key)
+	{
+		const rectf Rect = GetCellRect(Key);
+		const float DX = std::max({ Rect.position.x - Focus.x, 0.0f, Focus.x - (Rect.position.x + Rect.size.x) });
+		const float DY = std::max({ Rect.position.y - Focus.y, 0.0f, Focus.y - (Rect.position.y + Rect.size.y) });
+		return std::sqrt(DX * DX + DY * DY);
+	}
+}
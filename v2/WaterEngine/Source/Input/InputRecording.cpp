@@ -0,0 +1,146 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Input/InputRecording.h"
+#include "Utility/Log.h"
+
+#include <type_traits>
+
+namespace we
+{
+    namespace
+    {
+        template<typename T>
+        void Write(std::ofstream& Out, const T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Out.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+        }
+
+        template<typename T>
+        bool Read(std::ifstream& In, T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return static_cast<bool>(In.read(reinterpret_cast<char*>(&Value), sizeof(T)));
+        }
+
+        // Every record takes at least MinBytes, so a count that cannot fit in the rest of the file is corrupt
+        bool FitsInFile(std::ifstream& In, ulong FileSize, ulong Count, ulong MinBytes)
+        {
+            const auto Position = In.tellg();
+            if (Position < 0 || static_cast<ulong>(Position) > FileSize) return false;
+            return Count <= (FileSize - static_cast<ulong>(Position)) / MinBytes;
+        }
+
+        template<ulong Index = 0>
+        bool ReadBinding(std::ifstream& In, uint8 Alternative, Input::Binding& Binding)
+        {
+            if constexpr (Index < std::variant_size_v<Input::Binding>)
+            {
+                if (Alternative != Index)
+                    return ReadBinding<Index + 1>(In, Alternative, Binding);
+
+                std::variant_alternative_t<Index, Input::Binding> Value;
+                if (!Read(In, Value)) return false;
+                Binding = Value;
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+    }
+
+    bool InputRecording::SaveToFile(const string& Path) const
+    {
+        std::ofstream Out(Path, std::ios::binary);
+        if (!Out)
+        {
+            ERROR("[Input] Failed to open recording file {}", Path);
+            return false;
+        }
+
+        Write(Out, Magic);
+        Write(Out, Version);
+        Write(Out, Seed);
+
+        Write(Out, static_cast<uint>(DeltaTimes.size()));
+        Out.write(reinterpret_cast<const char*>(DeltaTimes.data()), DeltaTimes.size() * sizeof(float));
+
+        Write(Out, static_cast<uint>(Events.size()));
+        for (const auto& Event : Events)
+        {
+            Write(Out, Event.Frame);
+            Write(Out, Event.Time);
+            Write(Out, Event.Type);
+            Write(Out, static_cast<uint8>(Event.Binding.index()));
+            std::visit([&Out](const auto& Value) { Write(Out, Value); }, Event.Binding);
+        }
+
+        return static_cast<bool>(Out);
+    }
+
+    bool InputRecording::LoadFromFile(const string& Path)
+    {
+        std::ifstream In(Path, std::ios::binary | std::ios::ate);
+        if (!In)
+        {
+            ERROR("[Input] Failed to open recording file {}", Path);
+            return false;
+        }
+        const ulong FileSize = static_cast<ulong>(In.tellg());
+        In.seekg(0);
+
+        auto Truncated = [&Path]()
+        {
+            ERROR("[Input] Recording {} is truncated or corrupt", Path);
+            return false;
+        };
+
+        uint FileMagic = 0;
+        uint16 FileVersion = 0;
+        if (!Read(In, FileMagic) || FileMagic != Magic || !Read(In, FileVersion) || FileVersion != Version)
+        {
+            ERROR("[Input] {} is not a version {} input recording", Path, Version);
+            return false;
+        }
+
+        // Smallest encoding of an event, used to reject counts before allocating for them
+        constexpr ulong MinEventBytes = sizeof(uint64_t) + sizeof(float) + sizeof(EInputEventType) + sizeof(uint8);
+
+        uint FrameCount = 0;
+        if (!Read(In, Seed) || !Read(In, FrameCount)) return Truncated();
+        if (!FitsInFile(In, FileSize, FrameCount, sizeof(float))) return Truncated();
+
+        DeltaTimes.resize(FrameCount);
+        if (!In.read(reinterpret_cast<char*>(DeltaTimes.data()), FrameCount * sizeof(float))) return Truncated();
+
+        uint EventCount = 0;
+        if (!Read(In, EventCount)) return Truncated();
+        if (!FitsInFile(In, FileSize, EventCount, MinEventBytes)) return Truncated();
+
+        Events.resize(EventCount);
+        for (auto& Event : Events)
+        {
+            uint8 Alternative = 0;
+            if (!Read(In, Event.Frame) || !Read(In, Event.Time) || !Read(In, Event.Type) ||
+                !Read(In, Alternative) || !ReadBinding(In, Alternative, Event.Binding))
+            {
+                return Truncated();
+            }
+
+            // Read raw, so anything past the last value means a corrupt or foreign file
+            if (static_cast<uint8>(Event.Type) > static_cast<uint8>(EInputEventType::Cleared)) return Truncated();
+        }
+
+        // Replay walks events in frame order; a file written out of order would otherwise lose
+        // every event behind the first one whose frame already passed. Stable, so same-frame order holds
+        std::stable_sort(Events.begin(), Events.end(),
+            [](const InputEventRecord& A, const InputEventRecord& B) { return A.Frame < B.Frame; });
+
+        return true;
+    }
+}
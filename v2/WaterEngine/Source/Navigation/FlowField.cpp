@@ -0,0 +1,129 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Navigation/FlowField.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace we
+{
+	namespace
+	{
+		constexpr float Unreachable = std::numeric_limits<float>::max();
+		constexpr uint8 NoDirection = 0xFF;
+		constexpr float DiagonalCost = 1.41421356f;
+		constexpr float DiagonalStep = 0.70710678f;
+
+		constexpr array<vec2i, 8> Neighbors{ {
+			{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+			{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+		} };
+
+		constexpr array<vec2f, 8> Steps{ {
+			{ 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f },
+			{ DiagonalStep, DiagonalStep }, { DiagonalStep, -DiagonalStep },
+			{ -DiagonalStep, DiagonalStep }, { -DiagonalStep, -DiagonalStep }
+		} };
+	}
+
+	void NavFlowField::Build(shared<const NavGrid> InGrid, vec2i InGoalCell)
+	{
+		Grid = std::move(InGrid);
+		GoalCell = InGoalCell;
+
+		const ulong CellCount = Grid->GetCellCount();
+		Costs.assign(CellCount, Unreachable);
+		Directions.assign(CellCount, NoDirection);
+		Open.clear();
+
+		if (!Grid->IsWalkable(GoalCell)) return;
+
+		// Min-heap on cost; stale entries are skipped when popped
+		auto Later = [](const pair<float, uint>& A, const pair<float, uint>& B) { return A.first > B.first; };
+
+		Costs[Grid->GetIndex(GoalCell)] = 0.0f;
+		Open.push_back({ 0.0f, Grid->GetIndex(GoalCell) });
+
+		while (!Open.empty())
+		{
+			std::pop_heap(Open.begin(), Open.end(), Later);
+			const auto [Cost, Index] = Open.back();
+			Open.pop_back();
+
+			if (Cost > Costs[Index]) continue;
+
+			const vec2i Cell = Grid->GetCell(Index);
+			for (ulong i = 0; i < Neighbors.size(); ++i)
+			{
+				const vec2i Next = Cell + Neighbors[i];
+				if (!Grid->IsWalkable(Next)) continue;
+
+				const bool bDiagonal = i >= 4;
+				if (bDiagonal && (!Grid->IsWalkable({ Next.x, Cell.y }) || !Grid->IsWalkable({ Cell.x, Next.y })))
+					continue;
+
+				const uint NextIndex = Grid->GetIndex(Next);
+				const float NextCost = Cost + (bDiagonal ? DiagonalCost : 1.0f);
+				if (NextCost < Costs[NextIndex])
+				{
+					Costs[NextIndex] = NextCost;
+					Open.push_back({ NextCost, NextIndex });
+					std::push_heap(Open.begin(), Open.end(), Later);
+				}
+			}
+		}
+
+		// Every cell points at its cheapest neighbor. Blocked cells only have walkable neighbors
+		// when they sit on the edge of an obstacle's inflation, and lead agents pushed there back out
+		const vec2i Size = Grid->GetSize();
+		for (int Y = 0; Y < Size.y; ++Y)
+		{
+			for (int X = 0; X < Size.x; ++X)
+			{
+				const vec2i Cell{ X, Y };
+				const uint Index = Grid->GetIndex(Cell);
+				const bool bWalkable = Grid->IsWalkable(Cell);
+
+				float Best = bWalkable ? Costs[Index] : Unreachable;
+				for (uint8 i = 0; i < Neighbors.size(); ++i)
+				{
+					const vec2i Next = Cell + Neighbors[i];
+					if (!Grid->IsWalkable(Next)) continue;
+
+					if (bWalkable && i >= 4 && (!Grid->IsWalkable({ Next.x, Cell.y }) || !Grid->IsWalkable({ Cell.x, Next.y })))
+						continue;
+
+					const float NextCost = Costs[Grid->GetIndex(Next)];
+					if (NextCost < Best)
+					{
+						Best = NextCost;
+						Directions[Index] = i;
+					}
+				}
+			}
+		}
+	}
+
+	vec2f NavFlowField::GetDirection(vec2f Position) const
+	{
+		if (!Grid) return {};
+
+		const vec2i Cell = Grid->WorldToCell(Position);
+		if (!Grid->IsInside(Cell)) return {};
+
+		const uint8 Direction = Directions[Grid->GetIndex(Cell)];
+		return Direction != NoDirection ? Steps[Direction] : vec2f{};
+	}
+
+	optional<float> NavFlowField::GetCost(vec2i Cell) const
+	{
+		if (!Grid || !Grid->IsInside(Cell)) return std::nullopt;
+
+		const float Cost = Costs[Grid->GetIndex(Cell)];
+		if (Cost == Unreachable) return std::nullopt;
+		return Cost;
+	}
+}
@@ -0,0 +1,333 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Navigation/NavGrid.h"
+#include "Utility/Math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+namespace we
+{
+	namespace
+	{
+		constexpr float DiagonalCost = 1.41421356f;
+
+		float DistanceToSegment(vec2f Point, vec2f A, vec2f B)
+		{
+			const vec2f AB = B - A;
+			const float LengthSq = LengthSquared(AB);
+			const float T = LengthSq > 0.0f ? Clamp(((Point - A).x * AB.x + (Point - A).y * AB.y) / LengthSq, 0.0f, 1.0f) : 0.0f;
+			return Distance(Point, A + AB * T);
+		}
+
+		float DistanceToObstacle(vec2f Point, const NavObstacle& Obstacle)
+		{
+			switch (Obstacle.Type)
+			{
+			case NavObstacle::EType::Circle:
+				return Distance(Point, Obstacle.Points[0]);
+
+			case NavObstacle::EType::Segment:
+				return DistanceToSegment(Point, Obstacle.Points[0], Obstacle.Points[1]);
+
+			case NavObstacle::EType::Polygon:
+			{
+				bool bInside = true;
+				float Nearest = std::numeric_limits<float>::max();
+				for (uint8 i = 0; i < Obstacle.PointCount; ++i)
+				{
+					const vec2f A = Obstacle.Points[i];
+					const vec2f B = Obstacle.Points[(i + 1) % Obstacle.PointCount];
+					const vec2f Edge = B - A;
+					const vec2f ToPoint = Point - A;
+					if (Edge.x * ToPoint.y - Edge.y * ToPoint.x < 0.0f)
+					{
+						bInside = false;
+					}
+					Nearest = Min(Nearest, DistanceToSegment(Point, A, B));
+				}
+				return bInside ? 0.0f : Nearest;
+			}
+			}
+			return std::numeric_limits<float>::max();
+		}
+
+		rectf GetObstacleBounds(const NavObstacle& Obstacle, float Reach)
+		{
+			const uint8 Count = Obstacle.Type == NavObstacle::EType::Circle ? 1 : Obstacle.PointCount;
+
+			vec2f Low = Obstacle.Points[0];
+			vec2f High = Obstacle.Points[0];
+			for (uint8 i = 1; i < Count; ++i)
+			{
+				Low = { std::min(Low.x, Obstacle.Points[i].x), std::min(Low.y, Obstacle.Points[i].y) };
+				High = { std::max(High.x, Obstacle.Points[i].x), std::max(High.y, Obstacle.Points[i].y) };
+			}
+			return rectf(Low - vec2f{ Reach, Reach }, High - Low + vec2f{ Reach * 2.0f, Reach * 2.0f });
+		}
+
+		// Per-thread search state, sized to the largest grid searched so far. Stamps mark which
+		// entries belong to the current search, so nothing is cleared between searches
+		struct SearchScratch
+		{
+			vector<float> Cost;
+			vector<uint> Parent;
+			vector<uint> SeenStamp;
+			vector<uint> ClosedStamp;
+			uint Stamp = 0;
+
+			void Begin(ulong CellCount)
+			{
+				if (SeenStamp.size() < CellCount)
+				{
+					Cost.resize(CellCount);
+					Parent.resize(CellCount);
+					SeenStamp.assign(CellCount, 0);
+					ClosedStamp.assign(CellCount, 0);
+					Stamp = 0;
+				}
+
+				if (++Stamp == 0)
+				{
+					std::fill(SeenStamp.begin(), SeenStamp.end(), 0);
+					std::fill(ClosedStamp.begin(), ClosedStamp.end(), 0);
+					Stamp = 1;
+				}
+			}
+		};
+
+		thread_local SearchScratch Scratch;
+	}
+
+	NavGrid::NavGrid(const rectf& InBounds, float InCellSize)
+		: Origin{ InBounds.position }
+		, CellSize{ InCellSize }
+		, Width{ static_cast<int>(std::ceil(InBounds.size.x / InCellSize)) }
+		, Height{ static_cast<int>(std::ceil(InBounds.size.y / InCellSize)) }
+	{
+		Width = std::max(Width, 0);
+		Height = std::max(Height, 0);
+		Blocked.assign(static_cast<ulong>(Width) * Height, 0);
+	}
+
+	void NavGrid::Rasterize(const vector<NavObstacle>& Obstacles, const rectf& Region, float AgentRadius)
+	{
+		if (!IsValid()) return;
+
+		auto ClampCell = [this](vec2i Cell)
+		{
+			return vec2i{ Clamp(Cell.x, 0, Width - 1), Clamp(Cell.y, 0, Height - 1) };
+		};
+
+		const vec2i RegionMin = ClampCell(WorldToCell(Region.position));
+		const vec2i RegionMax = ClampCell(WorldToCell(Region.position + Region.size));
+
+		for (int Y = RegionMin.y; Y <= RegionMax.y; ++Y)
+		{
+			for (int X = RegionMin.x; X <= RegionMax.x; ++X)
+			{
+				Blocked[GetIndex({ X, Y })] = 0;
+			}
+		}
+
+		for (const auto& Obstacle : Obstacles)
+		{
+			const float Reach = AgentRadius + Obstacle.Radius;
+			const rectf Bounds = GetObstacleBounds(Obstacle, Reach);
+
+			const vec2i CellMin = ClampCell(WorldToCell(Bounds.position));
+			const vec2i CellMax = ClampCell(WorldToCell(Bounds.position + Bounds.size));
+
+			for (int Y = std::max(CellMin.y, RegionMin.y); Y <= std::min(CellMax.y, RegionMax.y); ++Y)
+			{
+				for (int X = std::max(CellMin.x, RegionMin.x); X <= std::min(CellMax.x, RegionMax.x); ++X)
+				{
+					uint8& Cell = Blocked[GetIndex({ X, Y })];
+					if (!Cell && DistanceToObstacle(CellToWorld({ X, Y }), Obstacle) <= Reach)
+					{
+						Cell = 1;
+					}
+				}
+			}
+		}
+	}
+
+	ulong NavGrid::GetBlockedCount() const
+	{
+		return static_cast<ulong>(std::count(Blocked.begin(), Blocked.end(), uint8{ 1 }));
+	}
+
+	vec2i NavGrid::WorldToCell(vec2f Position) const
+	{
+		return {
+			static_cast<int>(std::floor((Position.x - Origin.x) / CellSize)),
+			static_cast<int>(std::floor((Position.y - Origin.y) / CellSize))
+		};
+	}
+
+	vec2f NavGrid::CellToWorld(vec2i Cell) const
+	{
+		return Origin + vec2f{ (Cell.x + 0.5f) * CellSize, (Cell.y + 0.5f) * CellSize };
+	}
+
+	optional<vec2i> NavGrid::FindNearestWalkable(vec2i Cell, int MaxRadius) const
+	{
+		if (IsWalkable(Cell)) return Cell;
+
+		for (int Radius = 1; Radius <= MaxRadius; ++Radius)
+		{
+			optional<vec2i> Best;
+			int BestDistanceSq = 0;
+
+			// Walks the ring at this radius
+			for (int DY = -Radius; DY <= Radius; ++DY)
+			{
+				const int Step = (DY == -Radius || DY == Radius) ? 1 : Radius * 2;
+				for (int DX = -Radius; DX <= Radius; DX += Step)
+				{
+					const vec2i Candidate{ Cell.x + DX, Cell.y + DY };
+					const int DistanceSq = DX * DX + DY * DY;
+					if (IsWalkable(Candidate) && (!Best || DistanceSq < BestDistanceSq))
+					{
+						Best = Candidate;
+						BestDistanceSq = DistanceSq;
+					}
+				}
+			}
+
+			if (Best) return Best;
+		}
+		return std::nullopt;
+	}
+
+	bool NavGrid::HasLineOfSight(vec2i From, vec2i To) const
+	{
+		const int DX = std::abs(To.x - From.x);
+		const int DY = -std::abs(To.y - From.y);
+		const int SX = From.x < To.x ? 1 : -1;
+		const int SY = From.y < To.y ? 1 : -1;
+
+		int Error = DX + DY;
+		vec2i Cell = From;
+
+		while (true)
+		{
+			if (!IsWalkable(Cell)) return false;
+			if (Cell == To) return true;
+
+			const int Error2 = Error * 2;
+			const bool bStepX = Error2 >= DY;
+			const bool bStepY = Error2 <= DX;
+
+			// Diagonal steps need both side cells open, like diagonal moves in the search
+			if (bStepX && bStepY && (!IsWalkable({ Cell.x + SX, Cell.y }) || !IsWalkable({ Cell.x, Cell.y + SY })))
+				return false;
+
+			if (bStepX) { Error += DY; Cell.x += SX; }
+			if (bStepY) { Error += DX; Cell.y += SY; }
+		}
+	}
+
+	bool NavGrid::FindPath(vec2i Start, vec2i Goal, uint MaxExpanded, vector<vec2i>& OutCells) const
+	{
+		OutCells.clear();
+		if (!IsWalkable(Start) || !IsWalkable(Goal)) return false;
+
+		auto Heuristic = [Goal](vec2i Cell)
+		{
+			const float DX = static_cast<float>(std::abs(Cell.x - Goal.x));
+			const float DY = static_cast<float>(std::abs(Cell.y - Goal.y));
+			return (DX + DY) + (DiagonalCost - 2.0f) * std::min(DX, DY);
+		};
+
+		Scratch.Begin(Blocked.size());
+
+		using OpenEntry = pair<float, uint>;
+		std::priority_queue<OpenEntry, vector<OpenEntry>, std::greater<OpenEntry>> Open;
+
+		const uint StartIndex = GetIndex(Start);
+		const uint GoalIndex = GetIndex(Goal);
+		Scratch.Cost[StartIndex] = 0.0f;
+		Scratch.Parent[StartIndex] = StartIndex;
+		Scratch.SeenStamp[StartIndex] = Scratch.Stamp;
+		Open.push({ Heuristic(Start), StartIndex });
+
+		static constexpr array<vec2i, 8> Directions{ {
+			{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+			{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+		} };
+
+		uint Expanded = 0;
+		while (!Open.empty())
+		{
+			const uint Index = Open.top().second;
+			Open.pop();
+
+			// Stale entry for a cell already expanded through a cheaper route
+			if (Scratch.ClosedStamp[Index] == Scratch.Stamp) continue;
+			Scratch.ClosedStamp[Index] = Scratch.Stamp;
+
+			if (Index == GoalIndex) break;
+			if (++Expanded > MaxExpanded) return false;
+
+			const vec2i Cell = GetCell(Index);
+			for (const vec2i& Direction : Directions)
+			{
+				const vec2i Next = Cell + Direction;
+				if (!IsWalkable(Next)) continue;
+
+				const bool bDiagonal = Direction.x != 0 && Direction.y != 0;
+				if (bDiagonal && (!IsWalkable({ Next.x, Cell.y }) || !IsWalkable({ Cell.x, Next.y })))
+					continue;
+
+				const uint NextIndex = GetIndex(Next);
+				if (Scratch.ClosedStamp[NextIndex] == Scratch.Stamp) continue;
+
+				const float Cost = Scratch.Cost[Index] + (bDiagonal ? DiagonalCost : 1.0f);
+				if (Scratch.SeenStamp[NextIndex] == Scratch.Stamp && Cost >= Scratch.Cost[NextIndex])
+					continue;
+
+				Scratch.SeenStamp[NextIndex] = Scratch.Stamp;
+				Scratch.Cost[NextIndex] = Cost;
+				Scratch.Parent[NextIndex] = Index;
+				Open.push({ Cost + Heuristic(Next), NextIndex });
+			}
+		}
+
+		if (Scratch.ClosedStamp[GoalIndex] != Scratch.Stamp) return false;
+
+		for (uint Index = GoalIndex; ; Index = Scratch.Parent[Index])
+		{
+			OutCells.push_back(GetCell(Index));
+			if (Index == StartIndex) break;
+		}
+		std::reverse(OutCells.begin(), OutCells.end());
+		return true;
+	}
+
+	void NavGrid::SmoothPath(vector<vec2i>& InOutCells) const
+	{
+		if (InOutCells.size() <= 2) return;
+
+		vector<vec2i> Smoothed;
+		Smoothed.push_back(InOutCells.front());
+
+		ulong Anchor = 0;
+		for (ulong i = 2; i < InOutCells.size(); ++i)
+		{
+			if (!HasLineOfSight(InOutCells[Anchor], InOutCells[i]))
+			{
+				Anchor = i - 1;
+				Smoothed.push_back(InOutCells[Anchor]);
+			}
+		}
+		Smoothed.push_back(InOutCells.back());
+
+		InOutCells = std::move(Smoothed);
+	}
+}
@@ -0,0 +1,85 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Render/DrawCommand.h"
+#include "Render/BlendedSprite.h"
+
+namespace we
+{
+    optional<DrawCommand> DrawCommand::FromDrawable(const drawable& Drawable, ERenderLayer Layer, float Depth)
+    {
+        DrawCommand Command;
+        Command.Layer = Layer;
+        Command.Depth = Depth;
+
+        const auto* Sprite = dynamic_cast<const sprite*>(&Drawable);
+        const auto* Blended = dynamic_cast<const BlendedSprite*>(&Drawable);
+        if (Blended) Sprite = &Blended->Sprite;
+
+        if (Sprite)
+        {
+            Command.Blend = Blended ? Blended->Blend : sf::BlendAlpha;
+            Command.Texture = &Sprite->getTexture();
+            Command.TextureRect = Sprite->getTextureRect();
+            Command.Transform = Sprite->getTransform();
+            Command.Tint = Sprite->getColor();
+        }
+        else if (const auto* Shape = dynamic_cast<const sf::Shape*>(&Drawable))
+        {
+            // Fill only, as a fan over the shape's points. Untextured, since nothing keeps
+            // a shape's texture alive until the render thread draws it
+            Command.Kind = EKind::Vertices;
+            Command.Primitive = sf::PrimitiveType::TriangleFan;
+            Command.Transform = Shape->getTransform();
+            Command.Vertices.reserve(Shape->getPointCount());
+            for (ulong i = 0; i < Shape->getPointCount(); ++i)
+            {
+                Command.Vertices.push_back({ Shape->getPoint(i), Shape->getFillColor() });
+            }
+        }
+        else if (const auto* Vertices = dynamic_cast<const sf::VertexArray*>(&Drawable))
+        {
+            Command.Kind = EKind::Vertices;
+            Command.Primitive = Vertices->getPrimitiveType();
+            Command.Vertices.reserve(Vertices->getVertexCount());
+            for (ulong i = 0; i < Vertices->getVertexCount(); ++i)
+            {
+                Command.Vertices.push_back((*Vertices)[i]);
+            }
+        }
+        else
+        {
+            return std::nullopt;
+        }
+        return Command;
+    }
+
+    void DrawCommand::Submit(RenderSubsystem& Render) const
+    {
+        sf::RenderStates States(Transform);
+        States.blendMode = Blend;
+
+        if (Kind == EKind::Vertices)
+        {
+            if (Vertices.empty()) return;
+
+            sf::VertexArray Array(Primitive, Vertices.size());
+            for (ulong i = 0; i < Vertices.size(); ++i)
+            {
+                Array[i] = Vertices[i];
+            }
+            States.texture = Texture;
+            Render.Draw(Array, Layer, States);
+            return;
+        }
+
+        if (!Texture) return;
+
+        // The transform is applied through the render states, so the sprite stays at identity
+        sprite Sprite(*Texture, TextureRect);
+        Sprite.setColor(Tint);
+        Render.Draw(Sprite, Layer, States);
+    }
+}
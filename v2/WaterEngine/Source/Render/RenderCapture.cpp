@@ -0,0 +1,380 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Render/RenderCapture.h"
+#include "Render/BlendedSprite.h"
+#include "Subsystem/ResourceSubsystem.h"
+#include "Utility/Log.h"
+
+#include <type_traits>
+
+namespace we
+{
+    namespace
+    {
+        template<typename T>
+        void Write(std::ofstream& Out, const T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Out.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+        }
+
+        template<typename T>
+        bool Read(std::ifstream& In, T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return static_cast<bool>(In.read(reinterpret_cast<char*>(&Value), sizeof(T)));
+        }
+
+        void WriteString(std::ofstream& Out, const string& Value)
+        {
+            Write(Out, static_cast<uint16>(Value.size()));
+            Out.write(Value.data(), Value.size());
+        }
+
+        // Every record takes at least MinBytes, so a count that cannot fit in the rest of the file is corrupt
+        bool FitsInFile(std::ifstream& In, ulong FileSize, ulong Count, ulong MinBytes)
+        {
+            const auto Position = In.tellg();
+            if (Position < 0 || static_cast<ulong>(Position) > FileSize) return false;
+            return Count <= (FileSize - static_cast<ulong>(Position)) / MinBytes;
+        }
+
+        // Enums are read raw, so anything past the last value means a corrupt or foreign file
+        template<typename EnumType>
+        bool InRange(EnumType Value, EnumType Last)
+        {
+            return static_cast<uint>(Value) <= static_cast<uint>(Last);
+        }
+
+        bool ReadString(std::ifstream& In, string& Value)
+        {
+            uint16 Length = 0;
+            if (!Read(In, Length)) return false;
+            Value.resize(Length);
+            return static_cast<bool>(In.read(Value.data(), Length));
+        }
+
+        ECaptureBlend ToCaptureBlend(const sf::BlendMode& Mode)
+        {
+            if (Mode == sf::BlendAdd) return ECaptureBlend::Add;
+            if (Mode == sf::BlendMultiply) return ECaptureBlend::Multiply;
+            if (Mode == sf::BlendNone) return ECaptureBlend::None;
+            if (Mode == BlendPremultiplied) return ECaptureBlend::Premultiplied;
+            return ECaptureBlend::Alpha;
+        }
+
+        array<float, 6> ToCaptureTransform(const sf::Transform& Transform)
+        {
+            // 2D affine part of the column-major 4x4 matrix
+            const float* M = Transform.getMatrix();
+            return { M[0], M[4], M[12], M[1], M[5], M[13] };
+        }
+    }
+
+    // =========================================================================
+    // CapturedCommand
+    // =========================================================================
+    sf::Transform CapturedCommand::GetTransform() const
+    {
+        return sf::Transform(Transform[0], Transform[1], Transform[2],
+                             Transform[3], Transform[4], Transform[5],
+                             0.0f, 0.0f, 1.0f);
+    }
+
+    sf::BlendMode CapturedCommand::GetBlendMode() const
+    {
+        switch (Blend)
+        {
+            case ECaptureBlend::Add: return sf::BlendAdd;
+            case ECaptureBlend::Multiply: return sf::BlendMultiply;
+            case ECaptureBlend::None: return sf::BlendNone;
+            case ECaptureBlend::Premultiplied: return BlendPremultiplied;
+            default: return sf::BlendAlpha;
+        }
+    }
+
+    // =========================================================================
+    // RenderCapture
+    // =========================================================================
+    bool RenderCapture::SaveToFile(const string& Path) const
+    {
+        std::ofstream Out(Path, std::ios::binary);
+        if (!Out)
+        {
+            ERROR("[Render] Failed to open capture file {}", Path);
+            return false;
+        }
+
+        Write(Out, Magic);
+        Write(Out, Version);
+        Write(Out, Resolution);
+
+        Write(Out, static_cast<uint>(Textures.size()));
+        for (const auto& Texture : Textures)
+        {
+            Write(Out, Texture.Size);
+            WriteString(Out, Texture.Name);
+        }
+
+        Write(Out, static_cast<uint>(Frames.size()));
+        for (const auto& Frame : Frames)
+        {
+            Write(Out, Frame.WorldViewCenter);
+            Write(Out, Frame.WorldViewSize);
+            Write(Out, Frame.WorldViewRotation);
+            Write(Out, Frame.WorldViewport);
+
+            Write(Out, static_cast<uint>(Frame.Commands.size()));
+            for (const auto& Command : Frame.Commands)
+            {
+                Write(Out, Command.Kind);
+                Write(Out, Command.Layer);
+                Write(Out, Command.Blend);
+                Write(Out, static_cast<uint8>(Command.Primitive));
+                Write(Out, Command.TextureID);
+                Write(Out, Command.Transform);
+
+                if (Command.Kind == ECaptureKind::Sprite)
+                {
+                    Write(Out, Command.TextureRect);
+                    Write(Out, Command.Tint.toInteger());
+                }
+                else
+                {
+                    Write(Out, static_cast<uint>(Command.Vertices.size()));
+                    Out.write(reinterpret_cast<const char*>(Command.Vertices.data()),
+                        Command.Vertices.size() * sizeof(sf::Vertex));
+                }
+            }
+        }
+
+        return static_cast<bool>(Out);
+    }
+
+    bool RenderCapture::LoadFromFile(const string& Path)
+    {
+        std::ifstream In(Path, std::ios::binary | std::ios::ate);
+        if (!In)
+        {
+            ERROR("[Render] Failed to open capture file {}", Path);
+            return false;
+        }
+        const ulong FileSize = static_cast<ulong>(In.tellg());
+        In.seekg(0);
+
+        auto Truncated = [&Path]()
+        {
+            ERROR("[Render] Capture file {} is truncated or corrupt", Path);
+            return false;
+        };
+
+        uint FileMagic = 0;
+        uint16 FileVersion = 0;
+        if (!Read(In, FileMagic) || FileMagic != Magic || !Read(In, FileVersion) || FileVersion != Version)
+        {
+            ERROR("[Render] {} is not a version {} render capture", Path, Version);
+            return false;
+        }
+
+        // Smallest encoding of each record, used to reject counts before allocating for them
+        constexpr ulong MinTextureBytes = sizeof(vec2u) + sizeof(uint16);
+        constexpr ulong MinFrameBytes = sizeof(vec2f) * 2 + sizeof(float) + sizeof(rectf) + sizeof(uint);
+        constexpr ulong MinCommandBytes = sizeof(ECaptureKind) + sizeof(ERenderLayer) + sizeof(ECaptureBlend)
+            + sizeof(uint8) + sizeof(uint) + sizeof(array<float, 6>);
+
+        uint TextureCount = 0;
+        if (!Read(In, Resolution) || !Read(In, TextureCount)) return Truncated();
+        if (!FitsInFile(In, FileSize, TextureCount, MinTextureBytes)) return Truncated();
+
+        Textures.resize(TextureCount);
+        for (auto& Texture : Textures)
+        {
+            if (!Read(In, Texture.Size) || !ReadString(In, Texture.Name)) return Truncated();
+        }
+
+        uint FrameCount = 0;
+        if (!Read(In, FrameCount)) return Truncated();
+        if (!FitsInFile(In, FileSize, FrameCount, MinFrameBytes)) return Truncated();
+
+        Frames.resize(FrameCount);
+        for (auto& Frame : Frames)
+        {
+            uint CommandCount = 0;
+            if (!Read(In, Frame.WorldViewCenter) || !Read(In, Frame.WorldViewSize) ||
+                !Read(In, Frame.WorldViewRotation) || !Read(In, Frame.WorldViewport) ||
+                !Read(In, CommandCount))
+            {
+                return Truncated();
+            }
+            if (!FitsInFile(In, FileSize, CommandCount, MinCommandBytes)) return Truncated();
+
+            Frame.Commands.resize(CommandCount);
+            for (auto& Command : Frame.Commands)
+            {
+                uint8 Primitive = 0;
+                if (!Read(In, Command.Kind) || !Read(In, Command.Layer) || !Read(In, Command.Blend) ||
+                    !Read(In, Primitive) || !Read(In, Command.TextureID) || !Read(In, Command.Transform))
+                {
+                    return Truncated();
+                }
+                Command.Primitive = static_cast<sf::PrimitiveType>(Primitive);
+
+                const bool bValidTexture = Command.TextureID == CapturedCommand::NoTexture || Command.TextureID < Textures.size();
+                if (!InRange(Command.Kind, ECaptureKind::Vertices) ||
+                    static_cast<uint8>(Command.Layer) >= static_cast<uint8>(ERenderLayer::Count) ||
+                    !InRange(Command.Blend, ECaptureBlend::Premultiplied) ||
+                    !InRange(Command.Primitive, sf::PrimitiveType::TriangleFan) ||
+                    !bValidTexture)
+                {
+                    return Truncated();
+                }
+
+                if (Command.Kind == ECaptureKind::Sprite)
+                {
+                    uint Tint = 0;
+                    if (!Read(In, Command.TextureRect) || !Read(In, Tint)) return Truncated();
+                    Command.Tint = color(Tint);
+                }
+                else
+                {
+                    uint VertexCount = 0;
+                    if (!Read(In, VertexCount)) return Truncated();
+                    if (!FitsInFile(In, FileSize, VertexCount, sizeof(sf::Vertex))) return Truncated();
+                    Command.Vertices.resize(VertexCount);
+                    if (!In.read(reinterpret_cast<char*>(Command.Vertices.data()), VertexCount * sizeof(sf::Vertex))) return Truncated();
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // =========================================================================
+    // RenderCaptureRecorder
+    // =========================================================================
+    void RenderCaptureRecorder::Start(const string& Path, uint FrameCount, vec2u Resolution)
+    {
+        Capture = RenderCapture{};
+        Capture.Resolution = Resolution;
+        Capture.Frames.reserve(FrameCount);
+        OutputPath = Path;
+        FramesRemaining = FrameCount;
+        SkippedDraws = 0;
+        TextureIDs.clear();
+
+        LOG("[Render] Capturing {} frames to {}", FrameCount, Path);
+    }
+
+    void RenderCaptureRecorder::BeginFrame(const view& WorldView)
+    {
+        if (!IsActive()) return;
+
+        Capture.Frames.emplace_back();
+        bFrameOpen = true;
+        SetWorldView(WorldView);
+    }
+
+    void RenderCaptureRecorder::SetWorldView(const view& WorldView)
+    {
+        // The engine sets the next frame's view before BeginFrame; it must not land on the last frame
+        if (!IsActive() || !bFrameOpen) return;
+
+        CapturedFrame& Frame = Capture.Frames.back();
+        Frame.WorldViewCenter = WorldView.getCenter();
+        Frame.WorldViewSize = WorldView.getSize();
+        Frame.WorldViewRotation = WorldView.getRotation().asRadians();
+        Frame.WorldViewport = WorldView.getViewport();
+    }
+
+    void RenderCaptureRecorder::Record(const drawable& Drawable, ERenderLayer Layer, const sf::RenderStates& States)
+    {
+        if (!IsActive() || Capture.Frames.empty()) return;
+
+        CapturedCommand Command;
+        Command.Layer = Layer;
+        Command.Blend = ToCaptureBlend(States.blendMode);
+
+        if (const auto* Blended = dynamic_cast<const BlendedSprite*>(&Drawable))
+        {
+            sf::RenderStates BlendedStates = States;
+            BlendedStates.blendMode = Blended->Blend;
+            Record(Blended->Sprite, Layer, BlendedStates);
+            return;
+        }
+
+        if (const auto* Sprite = dynamic_cast<const sprite*>(&Drawable))
+        {
+            Command.Kind = ECaptureKind::Sprite;
+            Command.TextureID = GetTextureID(&Sprite->getTexture());
+            Command.TextureRect = Sprite->getTextureRect();
+            Command.Tint = Sprite->getColor();
+            Command.Transform = ToCaptureTransform(States.transform * Sprite->getTransform());
+        }
+        else if (const auto* Shape = dynamic_cast<const sf::Shape*>(&Drawable))
+        {
+            // Fill only, as a fan over the shape's points
+            Command.Kind = ECaptureKind::Vertices;
+            Command.Primitive = sf::PrimitiveType::TriangleFan;
+            Command.TextureID = GetTextureID(Shape->getTexture());
+            Command.Transform = ToCaptureTransform(States.transform * Shape->getTransform());
+            for (ulong i = 0; i < Shape->getPointCount(); ++i)
+            {
+                Command.Vertices.push_back({ Shape->getPoint(i), Shape->getFillColor() });
+            }
+        }
+        else if (const auto* Vertices = dynamic_cast<const sf::VertexArray*>(&Drawable))
+        {
+            Command.Kind = ECaptureKind::Vertices;
+            Command.Primitive = Vertices->getPrimitiveType();
+            Command.TextureID = GetTextureID(States.texture);
+            Command.Transform = ToCaptureTransform(States.transform);
+            for (ulong i = 0; i < Vertices->getVertexCount(); ++i)
+            {
+                Command.Vertices.push_back((*Vertices)[i]);
+            }
+        }
+        else
+        {
+            ++SkippedDraws;
+            return;
+        }
+
+        Capture.Frames.back().Commands.push_back(std::move(Command));
+    }
+
+    void RenderCaptureRecorder::EndFrame()
+    {
+        bFrameOpen = false;
+        if (!IsActive() || --FramesRemaining > 0) return;
+
+        if (Capture.SaveToFile(OutputPath))
+        {
+            LOG("[Render] Wrote {} frames, {} textures to {}", Capture.Frames.size(), Capture.Textures.size(), OutputPath);
+        }
+        if (SkippedDraws > 0)
+        {
+            WARNING("[Render] {} draws of unsupported drawable types were not captured", SkippedDraws);
+        }
+
+        Capture = RenderCapture{};
+        TextureIDs.clear();
+    }
+
+    uint RenderCaptureRecorder::GetTextureID(const texture* Texture)
+    {
+        if (!Texture) return CapturedCommand::NoTexture;
+
+        if (auto It = TextureIDs.find(Texture); It != TextureIDs.end())
+        {
+            return It->second;
+        }
+
+        uint ID = static_cast<uint>(Capture.Textures.size());
+        Capture.Textures.push_back({ Texture->getSize(), LoadAsset().FindTextureName(Texture) });
+        TextureIDs[Texture] = ID;
+        return ID;
+    }
+}
@@ -0,0 +1,127 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Render/RenderThread.h"
+#include "Subsystem/RenderSubsystem.h"
+#include "Subsystem/WindowSubsystem.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Log.h"
+
+namespace we
+{
+    RenderThread::RenderThread(RenderSubsystem& InRender, WindowSubsystem& InWindow)
+        : Render{InRender}
+        , Window{InWindow}
+    {
+    }
+
+    RenderThread::~RenderThread()
+    {
+        Stop();
+    }
+
+    void RenderThread::Start()
+    {
+        if (IsRunning()) return;
+
+        // A context can only be active on one thread at a time
+        if (!Window.setActive(false))
+        {
+            ERROR("[Render] Failed to release window context");
+            return;
+        }
+
+        bStopRequested = false;
+        Thread = std::thread(&RenderThread::Run, this);
+    }
+
+    void RenderThread::Stop()
+    {
+        if (!IsRunning()) return;
+
+        {
+            std::lock_guard Lock{Mutex};
+            bStopRequested = true;
+        }
+        Condition.notify_all();
+        Thread.join();
+
+        if (!Window.setActive(true))
+        {
+            ERROR("[Render] Failed to reclaim window context");
+        }
+    }
+
+    void RenderThread::Submit()
+    {
+        {
+            std::unique_lock Lock{Mutex};
+            Condition.wait(Lock, [this] { return !PendingIndex.has_value(); });
+            PendingIndex = BackIndex;
+            BackIndex ^= 1;
+        }
+        Condition.notify_all();
+    }
+
+    void RenderThread::WaitIdle()
+    {
+        if (!IsRunning()) return;
+
+        std::unique_lock Lock{Mutex};
+        Condition.wait(Lock, [this] { return !PendingIndex.has_value() && !bBusy; });
+    }
+
+    void RenderThread::Run()
+    {
+        if (!Window.setActive(true))
+        {
+            ERROR("[Render] Render thread failed to acquire window context");
+        }
+
+        while (true)
+        {
+            uint FrameIndex;
+            {
+                std::unique_lock Lock{Mutex};
+                Condition.wait(Lock, [this] { return PendingIndex.has_value() || bStopRequested; });
+
+                // Drain the last submitted frame before honouring a stop request
+                if (!PendingIndex) break;
+
+                FrameIndex = *PendingIndex;
+                PendingIndex.reset();
+                bBusy = true;
+            }
+            Condition.notify_all();
+
+            Execute(Frames[FrameIndex]);
+
+            {
+                std::lock_guard Lock{Mutex};
+                bBusy = false;
+            }
+            Condition.notify_all();
+        }
+
+        (void)Window.setActive(false);
+    }
+
+    void RenderThread::Execute(const RenderFrame& Frame)
+    {
+        Render.SetWorldView(Frame.WorldViewCenter, Frame.WorldViewZoom, Frame.WorldViewRotation);
+
+        for (const auto& Command : Frame.Commands)
+        {
+            Command.Submit(Render);
+        }
+
+        Render.EndFrame();
+
+        Window.setView(Frame.WindowView);
+        Window.clear(WEConfig.Render.WindowClearColor);
+        Window.draw(Render.GetCompositeSprite());
+        Window.display();
+    }
+}
@@ -0,0 +1,278 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Render/StaticLayerCache.h"
+#include "Framework/World/World.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Assert.h"
+#include "Utility/Log.h"
+
+#include <cmath>
+
+namespace we
+{
+    namespace
+    {
+        rectf Union(const rectf& A, const rectf& B)
+        {
+            vec2f Min{ std::min(A.position.x, B.position.x), std::min(A.position.y, B.position.y) };
+            vec2f Max{ std::max(A.position.x + A.size.x, B.position.x + B.size.x),
+                       std::max(A.position.y + A.size.y, B.position.y + B.size.y) };
+            return rectf(Min, Max - Min);
+        }
+    }
+
+    void StaticLayerCache::Update(World& InWorld)
+    {
+        static vector<const drawable*> Drawables;
+
+        Changed.clear();
+        InWorld.TakeStaticChanges(Changed);
+        if (Changed.empty())
+            return;
+
+        set<TileKey> DirtyTiles;
+        for (ActorID ID : Changed)
+        {
+            // Both the tiles it left and the tiles it now covers need re-rendering
+            if (auto It = Entries.find(ID); It != Entries.end())
+            {
+                for (TileKey Key : It->second.Tiles)
+                {
+                    DirtyTiles.insert(Key);
+
+                    auto Listed = TileActors.find(Key);
+                    std::erase(Listed->second, ID);
+                    if (Listed->second.empty())
+                    {
+                        TileActors.erase(Listed);
+                    }
+                }
+                Entries.erase(It);
+            }
+
+            Actor* StaticActor = InWorld.FindActor(ID);
+            if (!StaticActor || !StaticActor->IsStatic() || StaticActor->IsPendingDestroy() || !StaticActor->IsVisible())
+                continue;
+
+            // Transform setters only reach the sprite when the actor next ticks
+            StaticActor->UpdateTransform();
+
+            Drawables.clear();
+            StaticActor->GetDrawables(Drawables);
+
+            ActorEntry& Entry = Entries[ID];
+            Entry.Tiles = GetCoveredTiles(Drawables);
+            for (TileKey Key : Entry.Tiles)
+            {
+                DirtyTiles.insert(Key);
+                TileActors[Key].push_back(ID);
+            }
+        }
+
+        for (TileKey Key : DirtyTiles)
+        {
+            RebuildTile(InWorld, Key);
+        }
+    }
+
+    void StaticLayerCache::CollectVisible(const rectf& ViewBounds, vector<pair<const drawable*, float>>& OutDrawables) const
+    {
+        for (const auto& [Key, CachedTile] : Tiles)
+        {
+            if (!GetTileRect(Key).findIntersection(ViewBounds))
+                continue;
+
+            for (const auto& [Index, CachedBand] : CachedTile.Bands)
+            {
+                if (CachedBand.Bounds.findIntersection(ViewBounds))
+                {
+                    OutDrawables.emplace_back(CachedBand.Drawable.get(), CachedBand.Depth);
+                }
+            }
+        }
+    }
+
+    void StaticLayerCache::Clear()
+    {
+        Tiles.clear();
+        Entries.clear();
+        TileActors.clear();
+        Changed.clear();
+    }
+
+    ulong StaticLayerCache::GetBandCount() const
+    {
+        ulong Count = 0;
+        for (const auto& [Key, CachedTile] : Tiles)
+        {
+            Count += CachedTile.Bands.size();
+        }
+        return Count;
+    }
+
+    void StaticLayerCache::RebuildTile(const World& InWorld, TileKey Key)
+    {
+        struct BandDrawable
+        {
+            float Depth = 0.0f;
+            ActorID Owner = INVALID_ACTOR_ID;
+            const drawable* Drawable = nullptr;
+        };
+
+        struct BandContent
+        {
+            float Depth = 0.0f;
+            optional<rectf> Bounds;
+            vector<BandDrawable> Drawables;
+        };
+
+        const rectf TileRect = GetTileRect(Key);
+        map<int, BandContent> Contents;
+        vector<const drawable*> Drawables;
+
+        auto Listed = TileActors.find(Key);
+        if (Listed == TileActors.end())
+        {
+            Tiles.erase(Key);
+            return;
+        }
+
+        for (ActorID ID : Listed->second)
+        {
+            const Actor* StaticActor = InWorld.FindActor(ID);
+            if (!StaticActor)
+                continue;
+
+            const float Depth = StaticActor->GetRenderDepth();
+            const int BandIndex = static_cast<int>(std::floor(Depth / WEConfig.Render.StaticDepthBandSize));
+
+            Drawables.clear();
+            StaticActor->GetDrawables(Drawables);
+            for (const auto* Drawable : Drawables)
+            {
+                auto Bounds = GetBounds(*Drawable);
+                if (!Bounds) continue;
+
+                auto Clipped = Bounds->findIntersection(TileRect);
+                if (!Clipped) continue;
+
+                auto [It, bInserted] = Contents.try_emplace(BandIndex);
+                BandContent& Content = It->second;
+                Content.Depth = bInserted ? Depth : std::min(Content.Depth, Depth);
+                Content.Bounds = Content.Bounds ? Union(*Content.Bounds, *Clipped) : *Clipped;
+                Content.Drawables.push_back({ Depth, ID, Drawable });
+            }
+        }
+
+        if (Contents.empty())
+        {
+            Tiles.erase(Key);
+            return;
+        }
+
+        Tile& CachedTile = Tiles[Key];
+        CachedTile.Bands.clear();
+
+        for (auto& [Index, Content] : Contents)
+        {
+            // Snap to whole pixels so the cached texels line up with the world
+            vec2f Min{ std::floor(Content.Bounds->position.x), std::floor(Content.Bounds->position.y) };
+            vec2f Max{ std::ceil(Content.Bounds->position.x + Content.Bounds->size.x),
+                       std::ceil(Content.Bounds->position.y + Content.Bounds->size.y) };
+            rectf Bounds(Min, Max - Min);
+
+            Band& CachedBand = CachedTile.Bands[Index];
+            CachedBand.Depth = Content.Depth;
+            CachedBand.Bounds = Bounds;
+            CachedBand.Target = make_unique<renderTexture>();
+            VERIFY(CachedBand.Target->resize(vec2u(Bounds.size)));
+            CachedBand.Target->setSmooth(WEConfig.Render.bWorldLayerSmooth);
+            CachedBand.Target->setView(view(Bounds));
+            CachedBand.Target->clear(color::Transparent);
+
+            // Same order the world would use: depth first, then spawn order, which IDs follow.
+            // Stable, so one actor's drawables keep their own order
+            std::stable_sort(Content.Drawables.begin(), Content.Drawables.end(),
+                [](const BandDrawable& A, const BandDrawable& B)
+                {
+                    if (A.Depth != B.Depth)
+                    {
+                        return A.Depth < B.Depth;
+                    }
+                    return A.Owner < B.Owner;
+                });
+            for (const BandDrawable& Entry : Content.Drawables)
+            {
+                CachedBand.Target->draw(*Entry.Drawable);
+            }
+            CachedBand.Target->display();
+
+            CachedBand.Drawable = make_unique<BlendedSprite>(CachedBand.Target->getTexture(), BlendPremultiplied);
+            CachedBand.Drawable->Sprite.setPosition(Bounds.position);
+        }
+    }
+
+    vector<StaticLayerCache::TileKey> StaticLayerCache::GetCoveredTiles(const vector<const drawable*>& Drawables) const
+    {
+        const float TileSize = static_cast<float>(WEConfig.Render.StaticTileSize);
+        vector<TileKey> Covered;
+
+        for (const auto* Drawable : Drawables)
+        {
+            auto Bounds = GetBounds(*Drawable);
+            if (!Bounds)
+            {
+                static bool bWarned = false;
+                if (!bWarned)
+                {
+                    WARNING("[Render] Static actors can only cache sprites and shapes; other drawables are dropped");
+                    bWarned = true;
+                }
+                continue;
+            }
+
+            int MinX = static_cast<int>(std::floor(Bounds->position.x / TileSize));
+            int MinY = static_cast<int>(std::floor(Bounds->position.y / TileSize));
+            int MaxX = static_cast<int>(std::floor((Bounds->position.x + Bounds->size.x) / TileSize));
+            int MaxY = static_cast<int>(std::floor((Bounds->position.y + Bounds->size.y) / TileSize));
+
+            for (int Y = MinY; Y <= MaxY; ++Y)
+            {
+                for (int X = MinX; X <= MaxX; ++X)
+                {
+                    TileKey Key = MakeKey(X, Y);
+                    if (std::find(Covered.begin(), Covered.end(), Key) == Covered.end())
+                    {
+                        Covered.push_back(Key);
+                    }
+                }
+            }
+        }
+        return Covered;
+    }
+
+    StaticLayerCache::TileKey StaticLayerCache::MakeKey(int X, int Y)
+    {
+        return (static_cast<int64>(X) << 32) | static_cast<uint>(Y);
+    }
+
+    rectf StaticLayerCache::GetTileRect(TileKey Key)
+    {
+        const float TileSize = static_cast<float>(WEConfig.Render.StaticTileSize);
+        const int X = static_cast<int>(Key >> 32);
+        const int Y = static_cast<int>(static_cast<uint>(Key & 0xFFFFFFFF));
+        return rectf({ X * TileSize, Y * TileSize }, { TileSize, TileSize });
+    }
+
+    optional<rectf> StaticLayerCache::GetBounds(const drawable& Drawable)
+    {
+        if (const auto* Sprite = dynamic_cast<const sprite*>(&Drawable))
+            return Sprite->getGlobalBounds();
+        if (const auto* Shape = dynamic_cast<const sf::Shape*>(&Drawable))
+            return Shape->getGlobalBounds();
+        return std::nullopt;
+    }
+}
@@ -5,18 +5,41 @@
 
 #include "Subsystem/AudioSubsystem.h"
 #include "Subsystem/ResourceSubsystem.h"
+#include "Core/EngineConfig.h"
 #include "Utility/Math.h"
 #include "Utility/Log.h"
 
+#include <chrono>
+#include <cmath>
+
 namespace we
 {
     AudioSubsystem* AudioSubsystem::Instance = nullptr;
 
     AudioSubsystem::AudioSubsystem()
+        : Commands(WEConfig.Audio.CommandQueueCapacity)
+        , VoicePool(WEConfig.Audio.VoicePoolSize)
     {
         Instance = this;
-        ChannelVolumes.fill(0.5f);  // Default 50% volume for all channels
-        ChannelMuted.fill(false);
+        Settings.ChannelVolumes.fill(0.5f);  // Default 50% volume for all channels
+        Settings.ChannelMuted.fill(false);
+        Mix = Settings;
+        Stats.PoolSize = static_cast<uint>(VoicePool.size());
+        PublishedStats = Stats;
+
+        if (WEConfig.Audio.bUseAudioThread)
+        {
+            AudioThread = std::thread(&AudioSubsystem::RunAudioThread, this);
+        }
+    }
+
+    AudioSubsystem::~AudioSubsystem()
+    {
+        if (IsAudioThreadRunning())
+        {
+            bStopRequested.store(true, std::memory_order_release);
+            AudioThread.join();
+        }
     }
 
     AudioSubsystem& AudioSubsystem::Get()
@@ -26,8 +49,13 @@ namespace we
 
     void AudioSubsystem::Update(float DeltaTime)
     {
-        UpdateFades(DeltaTime);
-        CleanupStoppedSounds();
+        FrameTriggers.clear();
+
+        if (!IsAudioThreadRunning())
+        {
+            ProcessCommands();
+            Tick(DeltaTime);
+        }
     }
 
     void AudioSubsystem::PlayMusic(const string& Path, float FadeInDuration)
@@ -39,29 +67,7 @@ namespace we
             return;
         }
 
-        CurrentMusic = make_unique<MusicTrack>();
-        CurrentMusic->Music = MusicResource;
-        CurrentMusic->Music->setLooping(true);
-
-        if (FadeInDuration > 0.0f)
-        {
-            CurrentMusic->CurrentVolume = 0.0f;
-            CurrentMusic->TargetVolume = 1.0f;
-            CurrentMusic->FadeSpeed = 1.0f / FadeInDuration;
-            CurrentMusic->bFadingIn = true;
-        }
-        else
-        {
-            CurrentMusic->CurrentVolume = 1.0f;
-            CurrentMusic->FadeSpeed = 0.0f;
-        }
-
-        ApplyVolumeToMusic(*CurrentMusic, AudioChannel::Music);
-        
-        if (!bPaused)
-        {
-            CurrentMusic->Music->play();
-        }
+        Post({ .Type = AudioCommandType::PlayMusic, .Value = FadeInDuration, .Music = std::move(MusicResource) });
     }
 
     void AudioSubsystem::PlayAmbient(const string& Path, float FadeInDuration)
@@ -73,447 +79,637 @@ namespace we
             return;
         }
 
-        CurrentAmbient = make_unique<MusicTrack>();
-        CurrentAmbient->Music = MusicResource;
-        CurrentAmbient->Music->setLooping(true);
+        Post({ .Type = AudioCommandType::PlayAmbient, .Value = FadeInDuration, .Music = std::move(MusicResource) });
+    }
 
-        if (FadeInDuration > 0.0f)
-        {
-            CurrentAmbient->CurrentVolume = 0.0f;
-            CurrentAmbient->TargetVolume = 1.0f;
-            CurrentAmbient->FadeSpeed = 1.0f / FadeInDuration;
-            CurrentAmbient->bFadingIn = true;
-        }
-        else
+    void AudioSubsystem::CrossfadeMusic(const string& Path, float Duration)
+    {
+        if (Duration <= 0.0f)
         {
-            CurrentAmbient->CurrentVolume = 1.0f;
-            CurrentAmbient->FadeSpeed = 0.0f;
+            PlayMusic(Path);
+            return;
         }
 
-        ApplyVolumeToMusic(*CurrentAmbient, AudioChannel::Ambient);
-        
-        if (!bPaused)
+        auto MusicResource = LoadAsset().LoadMusic(Path);
+        if (!MusicResource)
         {
-            CurrentAmbient->Music->play();
+            ERROR("[Audio] Failed to load music for crossfade: {}", Path);
+            return;
         }
+
+        Post({ .Type = AudioCommandType::CrossfadeMusic, .Value = Duration, .Music = std::move(MusicResource) });
     }
 
-    void AudioSubsystem::PlaySFX(const string& Path)
+    void AudioSubsystem::CrossfadeAmbient(const string& Path, float Duration)
     {
-        auto Buffer = LoadAsset().LoadSound(Path);
-        if (!Buffer)
+        if (Duration <= 0.0f)
         {
-            ERROR("[Audio] Failed to load SFX: {}", Path);
+            PlayAmbient(Path);
             return;
         }
 
-        SFXInstance Instance;
-        Instance.Buffer = Buffer;
-        Instance.Sound = make_unique<sound>(*Buffer);
-        Instance.Sound->setVolume(GetEffectiveVolume(AudioChannel::SFX) * 100.0f);
-        
-        if (!bPaused)
+        auto MusicResource = LoadAsset().LoadMusic(Path);
+        if (!MusicResource)
         {
-            Instance.Sound->play();
+            ERROR("[Audio] Failed to load ambient for crossfade: {}", Path);
+            return;
         }
 
-        ActiveSFX.push_back(std::move(Instance));
+        Post({ .Type = AudioCommandType::CrossfadeAmbient, .Value = Duration, .Music = std::move(MusicResource) });
     }
 
-    void AudioSubsystem::PlayVoice(const string& Path)
+    void AudioSubsystem::PlaySFX(const string& Path, SoundPriority Priority)
     {
-        auto Buffer = LoadAsset().LoadSound(Path);
-        if (!Buffer)
-        {
-            ERROR("[Audio] Failed to load voice: {}", Path);
-            return;
-        }
+        PostSound(Path, AudioChannel::SFX, Priority);
+    }
 
-        SFXInstance Instance;
-        Instance.Buffer = Buffer;
-        Instance.Sound = make_unique<sound>(*Buffer);
-        Instance.Sound->setVolume(GetEffectiveVolume(AudioChannel::Voice) * 100.0f);
-        
-        if (!bPaused)
+    void AudioSubsystem::PlayVoice(const string& Path, SoundPriority Priority)
+    {
+        PostSound(Path, AudioChannel::Voice, Priority);
+    }
+
+    void AudioSubsystem::PlaySFXAt(const string& Path, vec2f WorldPosition, SoundPriority Priority)
+    {
+        // Rejected before the resource cache or the voice pool are touched, so distant emitters cost nothing
+        const float Radius = WEConfig.Audio.AudibleRadius;
+        if ((WorldPosition - ListenerPosition).lengthSquared() > Radius * Radius)
         {
-            Instance.Sound->play();
+            ++CulledSounds;
+            return;
         }
 
-        ActiveVoice.push_back(std::move(Instance));
+        PostSound(Path, AudioChannel::SFX, Priority, WorldPosition);
     }
 
-    void AudioSubsystem::StopMusic(float FadeDuration)
+    void AudioSubsystem::SetListenerPosition(vec2f Position)
     {
-        if (!CurrentMusic || !CurrentMusic->Music)
+        if (Position == ListenerPosition)
             return;
 
-        if (FadeDuration > 0.0f)
-        {
-            CurrentMusic->TargetVolume = 0.0f;
-            CurrentMusic->FadeSpeed = CurrentMusic->CurrentVolume / FadeDuration;
-        }
-        else
+        ListenerPosition = Position;
+        Post({ .Type = AudioCommandType::SetListener, .Position = Position });
+    }
+
+    void AudioSubsystem::SetSoundConcurrency(const string& Path, uint MaxInstances)
+    {
+        if (MaxInstances == 0)
         {
-            CurrentMusic->Music->stop();
-            CurrentMusic.reset();
+            SoundConcurrency.erase(Path);
+            return;
         }
+        SoundConcurrency[Path] = MaxInstances;
+    }
+
+    void AudioSubsystem::StopMusic(float FadeDuration)
+    {
+        Post({ .Type = AudioCommandType::StopMusic, .Value = FadeDuration });
     }
 
     void AudioSubsystem::StopAmbient(float FadeDuration)
     {
-        if (!CurrentAmbient || !CurrentAmbient->Music)
-            return;
+        Post({ .Type = AudioCommandType::StopAmbient, .Value = FadeDuration });
+    }
 
-        if (FadeDuration > 0.0f)
-        {
-            CurrentAmbient->TargetVolume = 0.0f;
-            CurrentAmbient->FadeSpeed = CurrentAmbient->CurrentVolume / FadeDuration;
-        }
-        else
-        {
-            CurrentAmbient->Music->stop();
-            CurrentAmbient.reset();
-        }
+    void AudioSubsystem::StopAllSFX()
+    {
+        Post({ .Type = AudioCommandType::StopChannel, .Channel = AudioChannel::SFX });
     }
 
-    void AudioSubsystem::CrossfadeMusic(const string& Path, float Duration)
+    void AudioSubsystem::StopAllVoice()
     {
-        if (Duration <= 0.0f)
-        {
-            PlayMusic(Path);
-            return;
-        }
+        Post({ .Type = AudioCommandType::StopChannel, .Channel = AudioChannel::Voice });
+    }
 
-        // Move current music to fading slot and fade it out
-        if (CurrentMusic && CurrentMusic->Music)
-        {
-            FadingMusic = std::move(CurrentMusic);
-            FadingMusic->TargetVolume = 0.0f;
-            FadingMusic->FadeSpeed = FadingMusic->CurrentVolume / Duration;
-            FadingMusic->bFadingIn = false;
-        }
+    void AudioSubsystem::StopAll()
+    {
+        Post({ .Type = AudioCommandType::StopAll });
+    }
 
-        // Load and start new music with fade in
-        auto MusicResource = LoadAsset().LoadMusic(Path);
-        if (!MusicResource)
+    void AudioSubsystem::SetMasterVolume(Volume Vol)
+    {
+        Settings.MasterVolume = Clamp(Vol, 0.0f, 1.0f);
+        Post({ .Type = AudioCommandType::SetMasterVolume, .Value = Settings.MasterVolume });
+    }
+
+    Volume AudioSubsystem::GetMasterVolume() const
+    {
+        return Settings.MasterVolume;
+    }
+
+    void AudioSubsystem::SetChannelVolume(AudioChannel Channel, Volume Vol)
+    {
+        if (Channel == AudioChannel::Master)
         {
-            ERROR("[Audio] Failed to load music for crossfade: {}", Path);
+            SetMasterVolume(Vol);
             return;
         }
 
-        CurrentMusic = make_unique<MusicTrack>();
-        CurrentMusic->Music = MusicResource;
-        CurrentMusic->Music->setLooping(true);
-        CurrentMusic->CurrentVolume = 0.0f;
-        CurrentMusic->TargetVolume = 1.0f;
-        CurrentMusic->FadeSpeed = 1.0f / Duration;
-        CurrentMusic->bFadingIn = true;
+        auto Index = static_cast<ulong>(Channel);
+        Settings.ChannelVolumes[Index] = Clamp(Vol, 0.0f, 1.0f);
+        Post({ .Type = AudioCommandType::SetChannelVolume, .Channel = Channel, .Value = Settings.ChannelVolumes[Index] });
+    }
 
-        ApplyVolumeToMusic(*CurrentMusic, AudioChannel::Music);
-        
-        if (!bPaused)
-        {
-            CurrentMusic->Music->play();
-        }
+    Volume AudioSubsystem::GetChannelVolume(AudioChannel Channel) const
+    {
+        if (Channel == AudioChannel::Master)
+            return Settings.MasterVolume;
+        return Settings.ChannelVolumes[static_cast<ulong>(Channel)];
     }
 
-    void AudioSubsystem::CrossfadeAmbient(const string& Path, float Duration)
+    void AudioSubsystem::SetMasterMuted(bool bMuted)
     {
-        if (Duration <= 0.0f)
+        Settings.bMasterMuted = bMuted;
+        Post({ .Type = AudioCommandType::SetMasterMuted, .bFlag = bMuted });
+    }
+
+    bool AudioSubsystem::IsMasterMuted() const
+    {
+        return Settings.bMasterMuted;
+    }
+
+    void AudioSubsystem::SetChannelMuted(AudioChannel Channel, bool bMuted)
+    {
+        if (Channel == AudioChannel::Master)
         {
-            PlayAmbient(Path);
+            SetMasterMuted(bMuted);
             return;
         }
 
-        // Move current ambient to fading slot and fade it out
-        if (CurrentAmbient && CurrentAmbient->Music)
-        {
-            FadingAmbient = std::move(CurrentAmbient);
-            FadingAmbient->TargetVolume = 0.0f;
-            FadingAmbient->FadeSpeed = FadingAmbient->CurrentVolume / Duration;
-            FadingAmbient->bFadingIn = false;
-        }
+        Settings.ChannelMuted[static_cast<ulong>(Channel)] = bMuted;
+        Post({ .Type = AudioCommandType::SetChannelMuted, .Channel = Channel, .bFlag = bMuted });
+    }
 
-        // Load and start new ambient with fade in
-        auto MusicResource = LoadAsset().LoadMusic(Path);
-        if (!MusicResource)
-        {
-            ERROR("[Audio] Failed to load ambient for crossfade: {}", Path);
+    bool AudioSubsystem::IsChannelMuted(AudioChannel Channel) const
+    {
+        if (Channel == AudioChannel::Master)
+            return Settings.bMasterMuted;
+        return Settings.ChannelMuted[static_cast<ulong>(Channel)];
+    }
+
+    void AudioSubsystem::SetPaused(bool bInPaused)
+    {
+        if (Settings.bPaused == bInPaused)
             return;
-        }
 
-        CurrentAmbient = make_unique<MusicTrack>();
-        CurrentAmbient->Music = MusicResource;
-        CurrentAmbient->Music->setLooping(true);
-        CurrentAmbient->CurrentVolume = 0.0f;
-        CurrentAmbient->TargetVolume = 1.0f;
-        CurrentAmbient->FadeSpeed = 1.0f / Duration;
-        CurrentAmbient->bFadingIn = true;
+        Settings.bPaused = bInPaused;
+        Post({ .Type = AudioCommandType::SetPaused, .bFlag = bInPaused });
+    }
 
-        ApplyVolumeToMusic(*CurrentAmbient, AudioChannel::Ambient);
-        
-        if (!bPaused)
-        {
-            CurrentAmbient->Music->play();
-        }
+    bool AudioSubsystem::IsPaused() const
+    {
+        return Settings.bPaused;
     }
 
-    void AudioSubsystem::StopAllSFX()
+    bool AudioSubsystem::IsMusicPlaying() const
     {
-        for (auto& Instance : ActiveSFX)
-        {
-            if (Instance.Sound)
-            {
-                Instance.Sound->stop();
-            }
-        }
-        ActiveSFX.clear();
+        return bMusicPlaying.load(std::memory_order_relaxed);
     }
 
-    void AudioSubsystem::StopAllVoice()
+    bool AudioSubsystem::IsAmbientPlaying() const
     {
-        for (auto& Instance : ActiveVoice)
-        {
-            if (Instance.Sound)
-            {
-                Instance.Sound->stop();
-            }
-        }
-        ActiveVoice.clear();
+        return bAmbientPlaying.load(std::memory_order_relaxed);
     }
 
-    void AudioSubsystem::StopAll()
+    ulong AudioSubsystem::GetActiveSFXCount() const
     {
-        StopMusic();
-        StopAmbient();
-        StopAllSFX();
-        StopAllVoice();
-        
-        // Also stop fading tracks
-        if (FadingMusic && FadingMusic->Music)
-        {
-            FadingMusic->Music->stop();
-            FadingMusic.reset();
-        }
-        if (FadingAmbient && FadingAmbient->Music)
-        {
-            FadingAmbient->Music->stop();
-            FadingAmbient.reset();
-        }
+        return ActiveSFXCount.load(std::memory_order_relaxed);
     }
 
-    void AudioSubsystem::SetMasterVolume(Volume Vol)
+    ulong AudioSubsystem::GetActiveVoiceCount() const
     {
-        MasterVolume = Clamp(Vol, 0.0f, 1.0f);
-        
-        if (CurrentMusic && CurrentMusic->Music)
+        return ActiveVoiceCount.load(std::memory_order_relaxed);
+    }
+
+    AudioVoiceStats AudioSubsystem::GetVoiceStats() const
+    {
+        AudioVoiceStats Result;
         {
-            ApplyVolumeToMusic(*CurrentMusic, AudioChannel::Music);
+            std::lock_guard Lock{StatsMutex};
+            Result = PublishedStats;
         }
-        if (FadingMusic && FadingMusic->Music)
+        Result.Merged = MergedTriggers;
+        Result.Culled = CulledSounds;
+        return Result;
+    }
+
+    void AudioSubsystem::Post(AudioCommand&& Command)
+    {
+        while (!Commands.Push(std::move(Command)))
         {
-            ApplyVolumeToMusic(*FadingMusic, AudioChannel::Music);
+            // Without the audio thread the game thread is the consumer too
+            if (!IsAudioThreadRunning())
+            {
+                ProcessCommands();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
         }
-        if (CurrentAmbient && CurrentAmbient->Music)
+    }
+
+    void AudioSubsystem::PostSound(const string& Path, AudioChannel Channel, SoundPriority Priority, optional<vec2f> Position)
+    {
+        auto Buffer = LoadAsset().LoadSound(Path);
+        if (!Buffer)
         {
-            ApplyVolumeToMusic(*CurrentAmbient, AudioChannel::Ambient);
+            ERROR("[Audio] Failed to load {}: {}", Channel == AudioChannel::Voice ? "voice" : "SFX", Path);
+            return;
         }
-        if (FadingAmbient && FadingAmbient->Music)
+
+        // Identical sounds started on the same frame would only play back as one louder sound.
+        // Positional ones still merge only when close together, or distant emitters would be lost
+        FrameTrigger Trigger{ .Buffer = Buffer.get() };
+        if (Position)
         {
-            ApplyVolumeToMusic(*FadingAmbient, AudioChannel::Ambient);
+            const float Cell = WEConfig.Audio.TriggerMergeDistance;
+            Trigger.Cell = vec2i{ static_cast<int>(std::floor(Position->x / Cell)), static_cast<int>(std::floor(Position->y / Cell)) };
         }
-        for (auto& Instance : ActiveSFX)
+        if (std::find(FrameTriggers.begin(), FrameTriggers.end(), Trigger) != FrameTriggers.end())
         {
-            if (Instance.Sound)
-            {
-                Instance.Sound->setVolume(GetEffectiveVolume(AudioChannel::SFX) * 100.0f);
-            }
+            ++MergedTriggers;
+            return;
         }
-        for (auto& Instance : ActiveVoice)
-        {
-            if (Instance.Sound)
+        FrameTriggers.push_back(Trigger);
+
+        Post({ .Type = AudioCommandType::PlaySound, .Channel = Channel, .Priority = Priority,
+               .MaxInstances = GetSoundConcurrency(Path), .Position = Position, .Buffer = std::move(Buffer) });
+    }
+
+    uint AudioSubsystem::GetSoundConcurrency(const string& Path) const
+    {
+        auto It = SoundConcurrency.find(Path);
+        return It != SoundConcurrency.end() ? It->second : WEConfig.Audio.MaxInstancesPerSound;
+    }
+
+    void AudioSubsystem::RunAudioThread()
+    {
+        using Clock = std::chrono::steady_clock;
+        const float StepSeconds = 1.0f / WEConfig.Audio.AudioUpdateRate;
+        const auto Step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(StepSeconds));
+        auto NextTick = Clock::now();
+
+        while (!bStopRequested.load(std::memory_order_acquire))
+        {
+            ProcessCommands();
+            Tick(StepSeconds);
+
+            // After a stall resume from now instead of bursting through the missed steps
+            NextTick = Max(NextTick + Step, Clock::now());
+            std::this_thread::sleep_until(NextTick);
+        }
+    }
+
+    void AudioSubsystem::ProcessCommands()
+    {
+        AudioCommand Command;
+        while (Commands.Pop(Command))
+        {
+            Execute(Command);
+        }
+        // Don't hold on to the last asset until the next command arrives
+        Command = {};
+    }
+
+    void AudioSubsystem::Execute(AudioCommand& Command)
+    {
+        switch (Command.Type)
+        {
+        case AudioCommandType::PlayMusic:
+            StartTrack(CurrentMusic, std::move(Command.Music), Command.Value, AudioChannel::Music);
+            break;
+        case AudioCommandType::PlayAmbient:
+            StartTrack(CurrentAmbient, std::move(Command.Music), Command.Value, AudioChannel::Ambient);
+            break;
+        case AudioCommandType::CrossfadeMusic:
+            CrossfadeTrack(CurrentMusic, FadingMusic, std::move(Command.Music), Command.Value, AudioChannel::Music);
+            break;
+        case AudioCommandType::CrossfadeAmbient:
+            CrossfadeTrack(CurrentAmbient, FadingAmbient, std::move(Command.Music), Command.Value, AudioChannel::Ambient);
+            break;
+        case AudioCommandType::PlaySound:
+            StartVoice(Command);
+            break;
+        case AudioCommandType::StopMusic:
+            StopTrack(CurrentMusic, Command.Value);
+            break;
+        case AudioCommandType::StopAmbient:
+            StopTrack(CurrentAmbient, Command.Value);
+            break;
+        case AudioCommandType::StopChannel:
+            StopVoices(Command.Channel);
+            break;
+        case AudioCommandType::StopAll:
+            StopAllTracks();
+            StopVoices(AudioChannel::SFX);
+            StopVoices(AudioChannel::Voice);
+            break;
+        case AudioCommandType::SetMasterVolume:
+            Mix.MasterVolume = Command.Value;
+            ApplyVolumeToAll();
+            break;
+        case AudioCommandType::SetChannelVolume:
+            Mix.ChannelVolumes[static_cast<ulong>(Command.Channel)] = Command.Value;
+            ApplyVolumeToAll();
+            break;
+        case AudioCommandType::SetMasterMuted:
+            Mix.bMasterMuted = Command.bFlag;
+            ApplyVolumeToAll();
+            break;
+        case AudioCommandType::SetChannelMuted:
+            Mix.ChannelMuted[static_cast<ulong>(Command.Channel)] = Command.bFlag;
+            ApplyVolumeToAll();
+            break;
+        case AudioCommandType::SetPaused:
+            Mix.bPaused = Command.bFlag;
+            ApplyPause();
+            break;
+        case AudioCommandType::SetListener:
+            MixListenerPosition = *Command.Position;
+            for (auto& Voice : VoicePool)
             {
-                Instance.Sound->setVolume(GetEffectiveVolume(AudioChannel::Voice) * 100.0f);
+                if (Voice.bActive && Voice.bPositional)
+                {
+                    UpdateSpatialization(Voice);
+                    Voice.Sound->setVolume(GetEffectiveVolume(Voice.Channel) * Voice.PositionGain * 100.0f);
+                }
             }
+            break;
         }
     }
 
-    Volume AudioSubsystem::GetMasterVolume() const
+    void AudioSubsystem::Tick(float DeltaTime)
     {
-        return MasterVolume;
+        UpdateFades(DeltaTime);
+        CleanupStoppedSounds();
+        PublishState();
     }
 
-    void AudioSubsystem::SetChannelVolume(AudioChannel Channel, Volume Vol)
+    void AudioSubsystem::PublishState()
     {
-        if (Channel == AudioChannel::Master)
+        bMusicPlaying.store(IsTrackPlaying(CurrentMusic) || IsTrackPlaying(FadingMusic), std::memory_order_relaxed);
+        bAmbientPlaying.store(IsTrackPlaying(CurrentAmbient) || IsTrackPlaying(FadingAmbient), std::memory_order_relaxed);
+        ActiveSFXCount.store(CountActiveVoices(AudioChannel::SFX), std::memory_order_relaxed);
+        ActiveVoiceCount.store(CountActiveVoices(AudioChannel::Voice), std::memory_order_relaxed);
+
+        std::lock_guard Lock{StatsMutex};
+        PublishedStats = Stats;
+    }
+
+    void AudioSubsystem::StartTrack(unique<MusicTrack>& Track, shared<music> Music, float FadeInDuration, AudioChannel Channel)
+    {
+        // The replaced track would otherwise keep playing from the resource cache
+        if (Track && Track->Music && Track->Music != Music)
         {
-            SetMasterVolume(Vol);
-            return;
+            Track->Music->stop();
         }
 
-        auto Index = static_cast<ulong>(Channel);
-        ChannelVolumes[Index] = Clamp(Vol, 0.0f, 1.0f);
+        Track = make_unique<MusicTrack>();
+        Track->Music = std::move(Music);
+        Track->Music->setLooping(true);
 
-        if (Channel == AudioChannel::Music)
+        if (FadeInDuration > 0.0f)
         {
-            if (CurrentMusic && CurrentMusic->Music)
-                ApplyVolumeToMusic(*CurrentMusic, Channel);
-            if (FadingMusic && FadingMusic->Music)
-                ApplyVolumeToMusic(*FadingMusic, Channel);
+            Track->CurrentVolume = 0.0f;
+            Track->TargetVolume = 1.0f;
+            Track->FadeSpeed = 1.0f / FadeInDuration;
+            Track->bFadingIn = true;
         }
-        else if (Channel == AudioChannel::Ambient)
+        else
         {
-            if (CurrentAmbient && CurrentAmbient->Music)
-                ApplyVolumeToMusic(*CurrentAmbient, Channel);
-            if (FadingAmbient && FadingAmbient->Music)
-                ApplyVolumeToMusic(*FadingAmbient, Channel);
+            Track->CurrentVolume = 1.0f;
+            Track->FadeSpeed = 0.0f;
         }
-        else if (Channel == AudioChannel::SFX)
+
+        ApplyVolumeToMusic(*Track, Channel);
+
+        if (!Mix.bPaused)
         {
-            for (auto& Instance : ActiveSFX)
-            {
-                if (Instance.Sound)
-                {
-                    Instance.Sound->setVolume(GetEffectiveVolume(Channel) * 100.0f);
-                }
-            }
+            Track->Music->play();
         }
-        else if (Channel == AudioChannel::Voice)
+    }
+
+    void AudioSubsystem::CrossfadeTrack(unique<MusicTrack>& Track, unique<MusicTrack>& Fading, shared<music> Music, float Duration, AudioChannel Channel)
+    {
+        // Move current track to fading slot and fade it out
+        if (Track && Track->Music)
         {
-            for (auto& Instance : ActiveVoice)
+            if (Fading && Fading->Music)
             {
-                if (Instance.Sound)
-                {
-                    Instance.Sound->setVolume(GetEffectiveVolume(Channel) * 100.0f);
-                }
+                Fading->Music->stop();
             }
+
+            Fading = std::move(Track);
+            Fading->TargetVolume = 0.0f;
+            Fading->FadeSpeed = Fading->CurrentVolume / Duration;
+            Fading->bFadingIn = false;
         }
+
+        StartTrack(Track, std::move(Music), Duration, Channel);
     }
 
-    Volume AudioSubsystem::GetChannelVolume(AudioChannel Channel) const
+    void AudioSubsystem::StopTrack(unique<MusicTrack>& Track, float FadeDuration)
     {
-        if (Channel == AudioChannel::Master)
-            return MasterVolume;
-        return ChannelVolumes[static_cast<ulong>(Channel)];
+        if (!Track || !Track->Music)
+            return;
+
+        if (FadeDuration > 0.0f)
+        {
+            Track->TargetVolume = 0.0f;
+            Track->FadeSpeed = Track->CurrentVolume / FadeDuration;
+        }
+        else
+        {
+            Track->Music->stop();
+            Track.reset();
+        }
     }
 
-    void AudioSubsystem::SetMasterMuted(bool bMuted)
+    void AudioSubsystem::StopAllTracks()
     {
-        bMasterMuted = bMuted;
-        SetMasterVolume(MasterVolume);
+        StopTrack(CurrentMusic, 0.0f);
+        StopTrack(CurrentAmbient, 0.0f);
+        StopTrack(FadingMusic, 0.0f);
+        StopTrack(FadingAmbient, 0.0f);
     }
 
-    bool AudioSubsystem::IsMasterMuted() const
+    void AudioSubsystem::ApplyVolumeToAll()
     {
-        return bMasterMuted;
+        if (CurrentMusic) ApplyVolumeToMusic(*CurrentMusic, AudioChannel::Music);
+        if (FadingMusic) ApplyVolumeToMusic(*FadingMusic, AudioChannel::Music);
+        if (CurrentAmbient) ApplyVolumeToMusic(*CurrentAmbient, AudioChannel::Ambient);
+        if (FadingAmbient) ApplyVolumeToMusic(*FadingAmbient, AudioChannel::Ambient);
+        ApplyVolumeToVoices(AudioChannel::Master);
     }
 
-    void AudioSubsystem::SetChannelMuted(AudioChannel Channel, bool bMuted)
+    void AudioSubsystem::ApplyPause()
     {
-        if (Channel == AudioChannel::Master)
+        for (auto* Track : { CurrentMusic.get(), FadingMusic.get(), CurrentAmbient.get(), FadingAmbient.get() })
         {
-            SetMasterMuted(bMuted);
-            return;
+            if (Track && Track->Music)
+            {
+                if (Mix.bPaused) Track->Music->pause();
+                else Track->Music->play();
+            }
         }
 
-        ChannelMuted[static_cast<ulong>(Channel)] = bMuted;
-        SetChannelVolume(Channel, ChannelVolumes[static_cast<ulong>(Channel)]);
-    }
-
-    bool AudioSubsystem::IsChannelMuted(AudioChannel Channel) const
-    {
-        if (Channel == AudioChannel::Master)
-            return bMasterMuted;
-        return ChannelMuted[static_cast<ulong>(Channel)];
+        for (auto& Voice : VoicePool)
+        {
+            if (Voice.bActive)
+            {
+                if (Mix.bPaused) Voice.Sound->pause();
+                else Voice.Sound->play();
+            }
+        }
     }
 
-    void AudioSubsystem::SetPaused(bool bInPaused)
+    void AudioSubsystem::StartVoice(const AudioCommand& Command)
     {
-        if (bPaused == bInPaused)
-            return;
-
-        bPaused = bInPaused;
-
-        // Music (current)
-        if (CurrentMusic && CurrentMusic->Music)
+        PooledVoice* Voice = AcquireVoice(*Command.Buffer, Command.MaxInstances, Command.Priority);
+        if (!Voice)
         {
-            if (bPaused) CurrentMusic->Music->pause();
-            else CurrentMusic->Music->play();
+            ++Stats.Rejected;
+            return;
         }
 
-        // Music (fading)
-        if (FadingMusic && FadingMusic->Music)
+        if (Voice->Sound)
         {
-            if (bPaused) FadingMusic->Music->pause();
-            else FadingMusic->Music->play();
+            Voice->Sound->setBuffer(*Command.Buffer);
         }
-
-        // Ambient (current)
-        if (CurrentAmbient && CurrentAmbient->Music)
+        else
         {
-            if (bPaused) CurrentAmbient->Music->pause();
-            else CurrentAmbient->Music->play();
+            Voice->Sound.emplace(*Command.Buffer);
         }
+        Voice->Buffer = Command.Buffer;
+        Voice->Channel = Command.Channel;
+        Voice->Priority = Command.Priority;
+        Voice->StartOrder = NextStartOrder++;
+        Voice->Position = Command.Position.value_or(vec2f{});
+        Voice->bPositional = Command.Position.has_value();
+        Voice->bActive = true;
+        UpdateSpatialization(*Voice);
+        Voice->Sound->setVolume(GetEffectiveVolume(Command.Channel) * Voice->PositionGain * 100.0f);
 
-        // Ambient (fading)
-        if (FadingAmbient && FadingAmbient->Music)
+        if (!Mix.bPaused)
         {
-            if (bPaused) FadingAmbient->Music->pause();
-            else FadingAmbient->Music->play();
+            Voice->Sound->play();
         }
 
-        // SFX
-        for (auto& Instance : ActiveSFX)
+        ++Stats.Played;
+        Stats.ActiveVoices = static_cast<uint>(CountActiveVoices(AudioChannel::Master));
+        Stats.PeakVoices = Max(Stats.PeakVoices, Stats.ActiveVoices);
+    }
+
+    AudioSubsystem::PooledVoice* AudioSubsystem::AcquireVoice(const soundBuffer& Buffer, uint MaxInstances, SoundPriority Priority)
+    {
+        PooledVoice* FreeVoice = nullptr;
+        PooledVoice* OldestInstance = nullptr;
+        PooledVoice* Victim = nullptr;
+        uint InstanceCount = 0;
+
+        for (auto& Voice : VoicePool)
         {
-            if (Instance.Sound)
+            if (!Voice.bActive)
             {
-                if (bPaused) Instance.Sound->pause();
-                else Instance.Sound->play();
+                if (!FreeVoice) FreeVoice = &Voice;
+                continue;
             }
-        }
 
-        // Voice
-        for (auto& Instance : ActiveVoice)
-        {
-            if (Instance.Sound)
+            if (Voice.Buffer.get() == &Buffer)
+            {
+                ++InstanceCount;
+                if (!OldestInstance || Voice.StartOrder < OldestInstance->StartOrder)
+                    OldestInstance = &Voice;
+            }
+
+            // Lowest priority first, oldest among equals
+            if (Voice.Priority <= Priority &&
+                (!Victim || Voice.Priority < Victim->Priority ||
+                 (Voice.Priority == Victim->Priority && Voice.StartOrder < Victim->StartOrder)))
             {
-                if (bPaused) Instance.Sound->pause();
-                else Instance.Sound->play();
+                Victim = &Voice;
             }
         }
+
+        // Past the cap the sound restarts on its own oldest voice instead of taking another
+        if (OldestInstance && InstanceCount >= MaxInstances)
+            Victim = OldestInstance;
+        else if (FreeVoice)
+            return FreeVoice;
+
+        if (Victim)
+        {
+            ReleaseVoice(*Victim);
+            ++Stats.Stolen;
+        }
+        return Victim;
     }
 
-    bool AudioSubsystem::IsPaused() const
+    void AudioSubsystem::ReleaseVoice(PooledVoice& Voice)
     {
-        return bPaused;
+        // Detached before the reference is dropped: once the cache holds the last one, the game
+        // thread may destroy the buffer, which walks the sounds still attached to it
+        if (Voice.Sound)
+        {
+            Voice.Sound->stop();
+            Voice.Sound->setBuffer(IdleBuffer);
+        }
+        Voice.Buffer.reset();
+        Voice.bActive = false;
     }
 
-    bool AudioSubsystem::IsMusicPlaying() const
+    void AudioSubsystem::StopVoices(AudioChannel Channel)
     {
-        bool CurrentPlaying = CurrentMusic && CurrentMusic->Music && 
-               CurrentMusic->Music->getStatus() == sf::SoundSource::Status::Playing;
-        bool FadingPlaying = FadingMusic && FadingMusic->Music && 
-               FadingMusic->Music->getStatus() == sf::SoundSource::Status::Playing;
-        return CurrentPlaying || FadingPlaying;
+        for (auto& Voice : VoicePool)
+        {
+            if (Voice.bActive && Voice.Channel == Channel)
+            {
+                ReleaseVoice(Voice);
+            }
+        }
+        Stats.ActiveVoices = static_cast<uint>(CountActiveVoices(AudioChannel::Master));
     }
 
-    bool AudioSubsystem::IsAmbientPlaying() const
+    void AudioSubsystem::ApplyVolumeToVoices(AudioChannel Channel)
     {
-        bool CurrentPlaying = CurrentAmbient && CurrentAmbient->Music && 
-               CurrentAmbient->Music->getStatus() == sf::SoundSource::Status::Playing;
-        bool FadingPlaying = FadingAmbient && FadingAmbient->Music && 
-               FadingAmbient->Music->getStatus() == sf::SoundSource::Status::Playing;
-        return CurrentPlaying || FadingPlaying;
+        for (auto& Voice : VoicePool)
+        {
+            if (Voice.bActive && (Channel == AudioChannel::Master || Voice.Channel == Channel))
+            {
+                Voice.Sound->setVolume(GetEffectiveVolume(Voice.Channel) * Voice.PositionGain * 100.0f);
+            }
+        }
     }
 
-    ulong AudioSubsystem::GetActiveSFXCount() const
+    void AudioSubsystem::UpdateSpatialization(PooledVoice& Voice) const
     {
-        return ActiveSFX.size();
+        if (!Voice.bPositional)
+        {
+            Voice.PositionGain = 1.0f;
+            Voice.Sound->setPan(0.0f);
+            return;
+        }
+
+        const vec2f Offset = Voice.Position - MixListenerPosition;
+        const float FullRadius = WEConfig.Audio.FullVolumeRadius;
+        const float Falloff = Clamp((Offset.length() - FullRadius) / (WEConfig.Audio.AudibleRadius - FullRadius), 0.0f, 1.0f);
+
+        // Squared falloff sounds closer to natural distance attenuation than a linear ramp
+        Voice.PositionGain = (1.0f - Falloff) * (1.0f - Falloff);
+        Voice.Sound->setPan(Clamp(Offset.x / WEConfig.Audio.PanDistance, -1.0f, 1.0f) * WEConfig.Audio.MaxPan);
     }
 
-    ulong AudioSubsystem::GetActiveVoiceCount() const
+    ulong AudioSubsystem::CountActiveVoices(AudioChannel Channel) const
     {
-        return ActiveVoice.size();
+        ulong Count = 0;
+        for (const auto& Voice : VoicePool)
+        {
+            if (Voice.bActive && (Channel == AudioChannel::Master || Voice.Channel == Channel))
+            {
+                ++Count;
+            }
+        }
+        return Count;
     }
 
     void AudioSubsystem::UpdateFades(float DeltaTime)
@@ -619,30 +815,18 @@ namespace we
 
     void AudioSubsystem::CleanupStoppedSounds()
     {
-        // Remove finished SFX
-        for (auto it = ActiveSFX.begin(); it != ActiveSFX.end();)
-        {
-            if (it->Sound && it->Sound->getStatus() == sf::SoundSource::Status::Stopped)
-            {
-                it = ActiveSFX.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        // Remove finished Voice
-        for (auto it = ActiveVoice.begin(); it != ActiveVoice.end();)
+        // Return finished SFX and Voice to the pool
+        // Sounds started while paused have not played yet, so they stay reserved
+        if (!Mix.bPaused)
         {
-            if (it->Sound && it->Sound->getStatus() == sf::SoundSource::Status::Stopped)
-            {
-                it = ActiveVoice.erase(it);
-            }
-            else
+            for (auto& Voice : VoicePool)
             {
-                ++it;
+                if (Voice.bActive && Voice.Sound->getStatus() == sf::SoundSource::Status::Stopped)
+                {
+                    ReleaseVoice(Voice);
+                }
             }
+            Stats.ActiveVoices = static_cast<uint>(CountActiveVoices(AudioChannel::Master));
         }
 
         // Clean up finished music that wasn't faded
@@ -685,12 +869,17 @@ namespace we
     Volume AudioSubsystem::GetEffectiveVolume(AudioChannel Channel) const
     {
         if (Channel == AudioChannel::Master)
-            return bMasterMuted ? 0.0f : MasterVolume;
+            return Mix.bMasterMuted ? 0.0f : Mix.MasterVolume;
 
         auto Index = static_cast<ulong>(Channel);
-        Volume ChannelVol = ChannelMuted[Index] ? 0.0f : ChannelVolumes[Index];
-        Volume MasterVol = bMasterMuted ? 0.0f : MasterVolume;
+        Volume ChannelVol = Mix.ChannelMuted[Index] ? 0.0f : Mix.ChannelVolumes[Index];
+        Volume MasterVol = Mix.bMasterMuted ? 0.0f : Mix.MasterVolume;
         
         return MasterVol * ChannelVol;
     }
+
+    bool AudioSubsystem::IsTrackPlaying(const unique<MusicTrack>& Track)
+    {
+        return Track && Track->Music && Track->Music->getStatus() == sf::SoundSource::Status::Playing;
+    }
 }
\ No newline at end of file
@@ -33,6 +33,11 @@ namespace we
 		return GlobalTick.getElapsedTime().asSeconds();
 	}
 
+	void ClockSubsystem::OverrideDeltaTime(float Seconds)
+	{
+		DeltaTime = sf::seconds(Seconds);
+	}
+
 	void ClockSubsystem::SetPaused(bool bInPaused)
 	{
 		bPaused = bInPaused;
@@ -17,6 +17,7 @@ namespace we
 		, CurrentPosition{}
 		, CursorSize{WEConfig.Cursor.CursorSize}
 		, bIsVisible{true}
+		, bChanged{true}
 	{
 		Instance = this;
 		auto Cur = LoadAsset().LoadTexture(WEConfig.Cursor.DefaultCursorTexture);
@@ -41,10 +42,19 @@ namespace we
 		CursorTexture = Texture;
 		CursorSprite.emplace(*CursorTexture);
 		CursorSprite->setScale({ ScaleX, ScaleY });
+		CursorSprite->setPosition(CurrentPosition);
+		bChanged = true;
+	}
+
+	void CursorSubsystem::SetVisibility(bool Visible)
+	{
+		bChanged |= bIsVisible != Visible;
+		bIsVisible = Visible;
 	}
 
 	void CursorSubsystem::SetPosition(vec2f Position)
 	{
+		bChanged |= CurrentPosition != Position;
 		CurrentPosition = Position;
 		if (CursorSprite.has_value())
 		{
@@ -58,4 +68,11 @@ namespace we
 			return nullptr;
 		return &*CursorSprite;
 	}
-}
\ No newline at end of file
+
+	bool CursorSubsystem::ConsumeChanges()
+	{
+		const bool bWasChanged = bChanged;
+		bChanged = false;
+		return bWasChanged;
+	}
+}
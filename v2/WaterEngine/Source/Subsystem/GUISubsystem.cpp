@@ -6,8 +6,34 @@
 #include "Subsystem/GuiSubsystem.h"
 #include "EventHandler/GUIEventHandler.h"
 
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+
+#include <string_view>
+
 namespace we
 {
+	namespace
+	{
+		void HashCombine(ulong& Seed, ulong Value)
+		{
+			Seed ^= Value + 0x9e3779b97f4a7c15ull + (Seed << 6) + (Seed >> 2);
+		}
+
+		void HashFloat(ulong& Seed, float Value)
+		{
+			HashCombine(Seed, std::hash<float>{}(Value));
+		}
+
+		// Hashes the UTF-32 storage directly; converting to std::string would allocate per widget per frame
+		void HashText(ulong& Seed, const tgui::String& Text)
+		{
+			HashCombine(Seed, std::hash<std::u32string_view>{}(std::u32string_view(Text.data(), Text.length())));
+		}
+	}
+
 	GUISubsystem* GUISubsystem::Instance = nullptr;
 
 	GUISubsystem::GUISubsystem()
@@ -75,11 +101,79 @@ namespace we
 
 	bool GUISubsystem::HandleEvent(const event& Event)
 	{
+		// Hover and focus can change even when the event is not consumed
+		ScreenUIChanges.bDirty = true;
+		WorldUIChanges.bDirty = true;
+
 		GUIEventHandler Handler{*this};
 		Event.visit(Handler);
 		return Handler.Consumed;
 	}
 
+	bool GUISubsystem::HasVisibleWidgets(const tgui::Gui& Gui)
+	{
+		for (const auto& Widget : Gui.getWidgets())
+		{
+			if (Widget->isVisible()) return true;
+		}
+		return false;
+	}
+
+	bool GUISubsystem::ConsumeChanges(tgui::Gui& Gui, ChangeTracker& Tracker)
+	{
+		// Timers, animations and blinking carets report whether they changed anything
+		bool bChanged = Gui.updateTime() || Tracker.bDirty;
+
+		// Game code edits widgets directly, so their visible state is compared with the last frame
+		ulong Signature = 0;
+		HashWidgets(Gui.getWidgets(), Signature);
+		bChanged |= Signature != Tracker.Signature;
+
+		Tracker.Signature = Signature;
+		Tracker.bDirty = false;
+		return bChanged;
+	}
+
+	void GUISubsystem::HashWidgets(const vector<tgui::Widget::Ptr>& Widgets, ulong& Seed)
+	{
+		for (const auto& Widget : Widgets)
+		{
+			HashCombine(Seed, reinterpret_cast<ulong>(Widget.get()));
+			HashCombine(Seed, Widget->isVisible());
+			if (!Widget->isVisible()) continue;
+
+			HashFloat(Seed, Widget->getPosition().x);
+			HashFloat(Seed, Widget->getPosition().y);
+			HashFloat(Seed, Widget->getSize().x);
+			HashFloat(Seed, Widget->getSize().y);
+			HashFloat(Seed, Widget->getInheritedOpacity());
+
+			if (auto Label = Widget->cast<tgui::Label>())
+			{
+				HashText(Seed, Label->getText());
+			}
+			else if (auto Button = Widget->cast<tgui::Button>())
+			{
+				HashText(Seed, Button->getText());
+			}
+			else if (auto Slider = Widget->cast<tgui::Slider>())
+			{
+				HashFloat(Seed, Slider->getValue());
+			}
+			else if (auto Toggle = Widget->cast<tgui::RadioButton>())
+			{
+				// Check boxes are radio buttons underneath
+				HashCombine(Seed, Toggle->isChecked());
+				HashText(Seed, Toggle->getText());
+			}
+
+			if (auto Child = Widget->cast<tgui::Container>())
+			{
+				HashWidgets(Child->getWidgets(), Seed);
+			}
+		}
+	}
+
 	void GUISubsystem::RequestFullscreen(bool bEnabled)
 	{
 		OnFullscreenRequested.Broadcast(bEnabled);
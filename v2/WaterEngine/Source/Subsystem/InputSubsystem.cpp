@@ -4,7 +4,12 @@
 // =============================================================================
 
 #include "Subsystem/InputSubsystem.h"
+#include "Subsystem/ClockSubsystem.h"
 #include "EventHandler/InputEventHandler.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Assert.h"
+#include "Utility/Math.h"
+#include "Utility/Log.h"
 
 namespace we
 {
@@ -54,6 +59,7 @@ namespace we
     InputSubsystem* InputSubsystem::Instance = nullptr;
 
     InputSubsystem::InputSubsystem()
+        : History(WEConfig.Input.EventHistorySize)
     {
         Instance = this;
     }
@@ -65,90 +71,351 @@ namespace we
 
     void InputSubsystem::HandleEvent(const sf::Event& event)
     {
+        // Recorded events stand in for the window's during replay
+        if (IsReplaying())
+            return;
+
         InputEventHandler Handler{ *this };
         event.visit(Handler);
     }
 
     void InputSubsystem::Bind(int InputAction, const Input::Binding& Binding)
     {
-        Bindings.emplace(InputAction, Binding);
+        VERIFY(InputAction >= 0);
+        GetState(InputAction);
+
+        auto& BoundActions = BindingIndex[Input::GetBindingKey(Binding)];
+        if (std::find(BoundActions.begin(), BoundActions.end(), InputAction) == BoundActions.end())
+        {
+            BoundActions.push_back(InputAction);
+        }
+    }
+
+    void InputSubsystem::Unbind(int InputAction, const Input::Binding& Binding)
+    {
+        auto It = BindingIndex.find(Input::GetBindingKey(Binding));
+        if (It == BindingIndex.end())
+            return;
+
+        std::erase(It->second, InputAction);
+        if (It->second.empty())
+        {
+            BindingIndex.erase(It);
+        }
+    }
+
+    void InputSubsystem::BeginFrame()
+    {
+        FrameIndex++;
+
+        if (Mode == ESessionMode::RecordPending)
+        {
+            Session = {};
+            Session.Seed = std::random_device{}();
+            RNG().SetSeed(Session.Seed);
+            SessionStartFrame = FrameIndex;
+            Mode = ESessionMode::Recording;
+            LOG("[Input] Recording started");
+        }
+        else if (Mode == ESessionMode::ReplayPending)
+        {
+            ClearAllInput();
+            RNG().SetSeed(Session.Seed);
+            SessionStartFrame = FrameIndex;
+            ReplayCursor = 0;
+            Mode = ESessionMode::Replaying;
+            LOG("[Input] Replaying {} frames", Session.DeltaTimes.size());
+        }
+
+        if (Mode == ESessionMode::Replaying)
+        {
+            DispatchReplayFrame();
+        }
     }
 
     bool InputSubsystem::Pressed(int InputAction) const
     {
-        return HeldActions.contains(InputAction);
+        const ActionState* State = FindState(InputAction);
+        return State && State->HeldCount > 0;
+    }
+
+    bool InputSubsystem::PressedThisFrame(int InputAction) const
+    {
+        const ActionState* State = FindState(InputAction);
+        return State && State->PressedFrame == FrameIndex;
+    }
+
+    bool InputSubsystem::ReleasedThisFrame(int InputAction) const
+    {
+        const ActionState* State = FindState(InputAction);
+        return State && State->ReleasedFrame == FrameIndex;
     }
 
     void InputSubsystem::OnPressed(const Input::Binding& Binding)
     {
-        for (const auto& [Action, BoundBinding] : Bindings)
+        RecordEvent(EInputEventType::Pressed, Binding);
+
+        auto It = BindingIndex.find(Input::GetBindingKey(Binding));
+        if (It == BindingIndex.end())
+            return;
+
+        const ulong First = Triggered.size();
+        for (int Action : It->second)
         {
-            if (Input::BindingsEqual(BoundBinding, Binding))
+            ActionState& State = Actions[Action];
+            if (State.HeldCount++ == 0)
             {
-                uint& Count = ActionPressCount[Action];
-                if (Count == 0)
+                State.PressedFrame = FrameIndex;
+                Triggered.push_back(Action);
+            }
+        }
+
+        // Run once the state is settled. Indexed, since a callback may bind a new action and grow Actions
+        ++DispatchDepth;
+        for (ulong t = First; t < Triggered.size(); ++t)
+        {
+            const int Action = Triggered[t];
+            for (ulong i = 0; i < Actions[Action].Callbacks.size(); ++i)
+            {
+                auto& [Token, Callback] = Actions[Action].Callbacks[i];
+                if (Token != 0)
                 {
-                    HeldActions.insert(Action);
-
-                    auto It = ActionCallbacks.find(Action);
-                    if (It != ActionCallbacks.end())
-                    {
-                        for (auto& [Token, Callback] : It->second)
-                        {
-                            Callback();
-                        }
-                    }
+                    Callback();
                 }
-                Count++;
             }
         }
+        --DispatchDepth;
+        Triggered.resize(First);
+
+        if (DispatchDepth == 0)
+        {
+            ApplyCallbackChanges();
+        }
     }
 
     void InputSubsystem::OnReleased(const Input::Binding& Binding)
     {
-        for (const auto& [Action, BoundBinding] : Bindings)
+        RecordEvent(EInputEventType::Released, Binding);
+
+        auto It = BindingIndex.find(Input::GetBindingKey(Binding));
+        if (It == BindingIndex.end())
+            return;
+
+        for (int Action : It->second)
         {
-            if (Input::BindingsEqual(BoundBinding, Binding))
+            ActionState& State = Actions[Action];
+            if (State.HeldCount > 0 && --State.HeldCount == 0)
             {
-                auto It = ActionPressCount.find(Action);
-                if (It != ActionPressCount.end())
-                {
-                    if (It->second > 0)
-                    {
-                        It->second--;
-                    }
-                    if (It->second == 0)
-                    {
-                        HeldActions.erase(Action);
-                    }
-                }
+                State.ReleasedFrame = FrameIndex;
             }
         }
     }
 
     void InputSubsystem::ClearAllInput()
     {
-        HeldActions.clear();
-        ActionPressCount.clear();
+        RecordEvent(EInputEventType::Cleared, Input::Keyboard{});
+
+        for (auto& State : Actions)
+        {
+            if (State.HeldCount > 0)
+            {
+                State.HeldCount = 0;
+                State.ReleasedFrame = FrameIndex;
+            }
+        }
     }
 
     BindingHandle InputSubsystem::BindAction(int InputAction, std::function<void()> Callback)
     {
+        VERIFY(InputAction >= 0);
         uint64_t Token = NextToken++;
-        ActionCallbacks[InputAction][Token] = std::move(Callback);
+        ActionState& State = GetState(InputAction);
+        if (DispatchDepth > 0)
+        {
+            AddedCallbacks.push_back({ InputAction, Token, std::move(Callback) });
+        }
+        else
+        {
+            State.Callbacks.emplace_back(Token, std::move(Callback));
+        }
         return BindingHandle(InputAction, Token, this);
     }
 
     void InputSubsystem::UnbindAction(int ActionId, uint64_t Token)
     {
-        auto It = ActionCallbacks.find(ActionId);
-        if (It != ActionCallbacks.end())
+        if (ActionId >= static_cast<int>(Actions.size()))
+            return;
+
+        auto& Callbacks = Actions[ActionId].Callbacks;
+        if (DispatchDepth == 0)
+        {
+            std::erase_if(Callbacks, [Token](const auto& Entry) { return Entry.first == Token; });
+            return;
+        }
+
+        // Erasing would move the callback that is running, so it is only marked until the press returns
+        for (auto& Entry : Callbacks)
+        {
+            if (Entry.first == Token)
+            {
+                Entry.first = 0;
+                bHasReleasedCallbacks = true;
+            }
+        }
+        std::erase_if(AddedCallbacks, [Token](const AddedCallback& Entry) { return Entry.Token == Token; });
+    }
+
+    void InputSubsystem::ApplyCallbackChanges()
+    {
+        if (bHasReleasedCallbacks)
+        {
+            for (auto& State : Actions)
+            {
+                std::erase_if(State.Callbacks, [](const auto& Entry) { return Entry.first == 0; });
+            }
+            bHasReleasedCallbacks = false;
+        }
+
+        for (auto& Entry : AddedCallbacks)
+        {
+            Actions[Entry.Action].Callbacks.emplace_back(Entry.Token, std::move(Entry.Callback));
+        }
+        AddedCallbacks.clear();
+    }
+
+    vector<InputEventRecord> InputSubsystem::GetRecentEvents() const
+    {
+        vector<InputEventRecord> Events;
+        Events.reserve(HistoryCount);
+        for (ulong i = 0; i < HistoryCount; ++i)
+        {
+            Events.push_back(History[(HistoryHead + History.size() - HistoryCount + i) % History.size()]);
+        }
+        return Events;
+    }
+
+    void InputSubsystem::StartRecording()
+    {
+        if (IsReplaying())
+        {
+            WARNING("[Input] Cannot record while replaying");
+            return;
+        }
+        Mode = ESessionMode::RecordPending;
+    }
+
+    bool InputSubsystem::StopRecording(const string& Path)
+    {
+        if (!IsRecording())
+            return false;
+
+        const bool bStarted = Mode == ESessionMode::Recording;
+        Mode = ESessionMode::Live;
+        if (!bStarted)
+            return false;
+
+        // The current frame's delta has not been recorded yet
+        std::erase_if(Session.Events, [this](const auto& Event) { return Event.Frame >= Session.DeltaTimes.size(); });
+
+        if (!Session.SaveToFile(Path))
+            return false;
+
+        LOG("[Input] Saved {} frames and {} events to {}", Session.DeltaTimes.size(), Session.Events.size(), Path);
+        return true;
+    }
+
+    bool InputSubsystem::StartReplay(const string& Path)
+    {
+        if (IsRecording())
         {
-            It->second.erase(Token);
-            if (It->second.empty())
+            WARNING("[Input] Cannot replay while recording");
+            return false;
+        }
+
+        // A file that fails to load leaves the previous session untouched
+        InputRecording Loaded;
+        if (!Loaded.LoadFromFile(Path))
+            return false;
+
+        Session = std::move(Loaded);
+        Mode = ESessionMode::ReplayPending;
+        return true;
+    }
+
+    void InputSubsystem::StopReplay()
+    {
+        if (!IsReplaying())
+            return;
+
+        Mode = ESessionMode::Live;
+        ClearAllInput();
+    }
+
+    void InputSubsystem::SyncClock(ClockSubsystem& Clock)
+    {
+        if (Mode == ESessionMode::Recording)
+        {
+            Session.DeltaTimes.push_back(Clock.GetDeltaTime());
+        }
+        else if (Mode == ESessionMode::Replaying)
+        {
+            Clock.OverrideDeltaTime(Session.DeltaTimes[FrameIndex - SessionStartFrame]);
+        }
+    }
+
+    void InputSubsystem::RecordEvent(EInputEventType Type, const Input::Binding& Binding)
+    {
+        InputEventRecord Event{ FrameIndex, SessionClock.getElapsedTime().asSeconds(), Type, Binding };
+
+        if (!History.empty())
+        {
+            History[HistoryHead] = Event;
+            HistoryHead = (HistoryHead + 1) % History.size();
+            HistoryCount = Min(HistoryCount + 1, History.size());
+        }
+
+        if (Mode == ESessionMode::Recording)
+        {
+            Event.Frame -= SessionStartFrame;
+            Session.Events.push_back(Event);
+        }
+    }
+
+    void InputSubsystem::DispatchReplayFrame()
+    {
+        const uint64_t Frame = FrameIndex - SessionStartFrame;
+        if (Frame >= Session.DeltaTimes.size())
+        {
+            LOG("[Input] Replay finished");
+            StopReplay();
+            return;
+        }
+
+        for (; ReplayCursor < Session.Events.size() && Session.Events[ReplayCursor].Frame == Frame; ++ReplayCursor)
+        {
+            const auto& Event = Session.Events[ReplayCursor];
+            switch (Event.Type)
             {
-                ActionCallbacks.erase(It);
+            case EInputEventType::Pressed: OnPressed(Event.Binding); break;
+            case EInputEventType::Released: OnReleased(Event.Binding); break;
+            case EInputEventType::Cleared: ClearAllInput(); break;
             }
         }
     }
-}
+
+    InputSubsystem::ActionState& InputSubsystem::GetState(int InputAction)
+    {
+        if (InputAction >= static_cast<int>(Actions.size()))
+        {
+            Actions.resize(InputAction + 1);
+        }
+        return Actions[InputAction];
+    }
+
+    const InputSubsystem::ActionState* InputSubsystem::FindState(int InputAction) const
+    {
+        if (InputAction < 0 || InputAction >= static_cast<int>(Actions.size()))
+            return nullptr;
+        return &Actions[InputAction];
+    }
+}
\ No newline at end of file
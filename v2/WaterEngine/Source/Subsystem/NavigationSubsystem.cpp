@@ -0,0 +1,466 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Subsystem/NavigationSubsystem.h"
+#include "Subsystem/PhysicsSubsystem.h"
+#include "Core/EngineConfig.h"
+#include "Utility/JobSystem.h"
+#include "Utility/Math.h"
+#include "Utility/Log.h"
+#include "box2d/b2_body.h"
+#include "box2d/b2_fixture.h"
+#include "box2d/b2_circle_shape.h"
+#include "box2d/b2_edge_shape.h"
+#include "box2d/b2_chain_shape.h"
+#include "box2d/b2_polygon_shape.h"
+
+namespace we
+{
+	namespace
+	{
+		int64 GetPathKey(const NavGrid& Grid, vec2i Start, vec2i Goal)
+		{
+			return (static_cast<int64>(Grid.GetIndex(Start)) << 32) | Grid.GetIndex(Goal);
+		}
+
+		NavPath SearchPath(const NavGrid& Grid, vec2i Start, vec2i Goal)
+		{
+			NavPath Path;
+			vector<vec2i> Cells;
+			if (!Grid.FindPath(Start, Goal, WEConfig.Navigation.MaxSearchNodes, Cells))
+				return Path;
+
+			Grid.SmoothPath(Cells);
+
+			// The first cell is where the agent already stands, unless it is also the goal
+			Path.bFound = true;
+			for (ulong i = Cells.size() > 1 ? 1 : 0; i < Cells.size(); ++i)
+			{
+				Path.Points.push_back(Grid.CellToWorld(Cells[i]));
+			}
+			return Path;
+		}
+	}
+
+	NavigationSubsystem::NavigationSubsystem(PhysicsSubsystem& InPhysics)
+		: Physics{ InPhysics }
+		, Finished{ make_shared<Mailbox>() }
+	{
+	}
+
+	void NavigationSubsystem::RequestBake()
+	{
+		bFullBakePending = true;
+	}
+
+	void NavigationSubsystem::Reset()
+	{
+		// Anything still running finishes against the old epoch and is dropped
+		++Epoch;
+		Grid.reset();
+		++GridVersion;
+		bFullBakePending = false;
+		bBakeInFlight = false;
+
+		Requests.clear();
+		WaitingForGrid.clear();
+		ReadyPaths.clear();
+		InFlight.clear();
+		PathCache.clear();
+		CacheOrder.clear();
+		FlowFields.clear();
+
+		std::lock_guard Lock{ Finished->Mutex };
+		Finished->Paths.clear();
+		Finished->Fields.clear();
+		Finished->Bakes.clear();
+	}
+
+	void NavigationSubsystem::Tick()
+	{
+		if (!bBakeInFlight && bFullBakePending)
+		{
+			StartBake();
+		}
+
+		vector<PathResult> Paths;
+		vector<FlowFieldResult> Fields;
+		vector<BakeResult> Bakes;
+		{
+			std::lock_guard Lock{ Finished->Mutex };
+			Paths.swap(Finished->Paths);
+			Fields.swap(Finished->Fields);
+			Bakes.swap(Finished->Bakes);
+		}
+
+		// Bakes started before a Reset can still finish after it; only the current epoch's counts.
+		// One bake is in flight per epoch, so at most one result survives
+		optional<BakeResult> Bake;
+		for (auto& Result : Bakes)
+		{
+			if (Result.Epoch == Epoch)
+			{
+				Bake = std::move(Result);
+			}
+		}
+
+		if (Bake)
+		{
+			Grid = std::move(Bake->Grid);
+			++GridVersion;
+			bBakeInFlight = false;
+			PathCache.clear();
+			CacheOrder.clear();
+
+			LOG("[Navigation] Baked {}x{} grid, {} of {} cells blocked, in {:.2f} ms",
+				Grid->GetSize().x, Grid->GetSize().y, Grid->GetBlockedCount(), Grid->GetCellCount(), Bake->Milliseconds);
+
+			vector<NavRequestID> Waiting;
+			Waiting.swap(WaitingForGrid);
+			for (NavRequestID ID : Waiting)
+			{
+				Dispatch(ID);
+			}
+
+			for (auto& [ID, Field] : FlowFields)
+			{
+				UpdateFlowField(ID, Field);
+			}
+		}
+
+		for (const auto& Result : Fields)
+		{
+			if (Result.Epoch != Epoch) continue;
+
+			auto It = FlowFields.find(Result.ID);
+			if (It == FlowFields.end()) continue;
+
+			// Safe to flip here: agents only read the front buffer from the game thread
+			FlowFieldState& Field = It->second;
+			Field.Front ^= 1;
+			Field.bBuilding = false;
+
+			// Catches up with goal moves and bakes that happened during the build
+			UpdateFlowField(Result.ID, Field);
+		}
+
+		for (auto& Result : Paths)
+		{
+			if (Result.Epoch != Epoch) continue;
+
+			auto It = InFlight.find(Result.Key);
+			if (It == InFlight.end()) continue;
+
+			vector<NavRequestID> Sharing = std::move(It->second);
+			InFlight.erase(It);
+
+			// The grid changed while this was searched; ask again against the new one
+			if (Result.GridVersion != GridVersion)
+			{
+				for (NavRequestID ID : Sharing)
+				{
+					Dispatch(ID);
+				}
+				continue;
+			}
+
+			CachePath(Result.Key, Result.Path);
+			for (NavRequestID ID : Sharing)
+			{
+				Deliver(ID, *Result.Path);
+			}
+		}
+
+		vector<pair<NavRequestID, shared<const NavPath>>> Ready;
+		Ready.swap(ReadyPaths);
+		for (const auto& [ID, Path] : Ready)
+		{
+			Deliver(ID, *Path);
+		}
+	}
+
+	void NavigationSubsystem::StartBake()
+	{
+		bFullBakePending = false;
+
+		auto Bounds = Physics.GetStaticBounds();
+		if (!Bounds)
+		{
+			WARNING("[Navigation] No static collision to bake");
+			return;
+		}
+
+		// Open ground around the outermost collision stays walkable
+		const float Padding = WEConfig.Navigation.AgentRadius + WEConfig.Navigation.CellSize;
+		const rectf Region(Bounds->position - vec2f{ Padding, Padding }, Bounds->size + vec2f{ Padding * 2.0f, Padding * 2.0f });
+		bBakeInFlight = true;
+
+		// Box2D is not thread-safe, so shapes are copied out here and rasterized on a worker
+		vector<NavObstacle> Obstacles;
+		CollectObstacles(Region, Obstacles);
+
+		GetJobs().Enqueue([Results = Finished, Region, Obstacles = std::move(Obstacles), BakeEpoch = Epoch]()
+		{
+			clock Timer;
+
+			auto Baked = make_shared<NavGrid>(Region, WEConfig.Navigation.CellSize);
+			Baked->Rasterize(Obstacles, Region, WEConfig.Navigation.AgentRadius);
+
+			BakeResult Result;
+			Result.Grid = std::move(Baked);
+			Result.Epoch = BakeEpoch;
+			Result.Milliseconds = Timer.getElapsedTime().asSeconds() * 1000.0f;
+
+			std::lock_guard Lock{ Results->Mutex };
+			Results->Bakes.push_back(std::move(Result));
+		});
+	}
+
+	void NavigationSubsystem::CollectObstacles(const rectf& Region, vector<NavObstacle>& OutObstacles) const
+	{
+		// Shapes just outside the region still block the cells at its edge
+		const float Reach = WEConfig.Navigation.AgentRadius + WEConfig.Navigation.CellSize;
+		const rectf Query(Region.position - vec2f{ Reach, Reach }, Region.size + vec2f{ Reach * 2.0f, Reach * 2.0f });
+
+		auto ToPixels = [this](const b2Transform& Transform, const b2Vec2& Local)
+		{
+			const b2Vec2 World = b2Mul(Transform, Local);
+			return Physics.MetersToPixels(vec2f{ World.x, World.y });
+		};
+
+		auto AddSegment = [&](const b2Transform& Transform, const b2Vec2& A, const b2Vec2& B, float Skin)
+		{
+			NavObstacle& Segment = OutObstacles.emplace_back();
+			Segment.Type = NavObstacle::EType::Segment;
+			Segment.Points[0] = ToPixels(Transform, A);
+			Segment.Points[1] = ToPixels(Transform, B);
+			Segment.PointCount = 2;
+			Segment.Radius = Physics.MetersToPixels(Skin);
+		};
+
+		Physics.QueryStaticFixtures(Query, [&](const b2Fixture& Fixture)
+		{
+			const b2Transform& Transform = Fixture.GetBody()->GetTransform();
+			const b2Shape* Shape = Fixture.GetShape();
+
+			switch (Shape->GetType())
+			{
+			case b2Shape::e_circle:
+			{
+				const auto* Circle = static_cast<const b2CircleShape*>(Shape);
+				NavObstacle& Obstacle = OutObstacles.emplace_back();
+				Obstacle.Type = NavObstacle::EType::Circle;
+				Obstacle.Points[0] = ToPixels(Transform, Circle->m_p);
+				Obstacle.PointCount = 1;
+				Obstacle.Radius = Physics.MetersToPixels(Circle->m_radius);
+				break;
+			}
+			case b2Shape::e_polygon:
+			{
+				const auto* Polygon = static_cast<const b2PolygonShape*>(Shape);
+				NavObstacle& Obstacle = OutObstacles.emplace_back();
+				Obstacle.Type = NavObstacle::EType::Polygon;
+				Obstacle.PointCount = static_cast<uint8>(Min<int32>(Polygon->m_count, static_cast<int32>(Obstacle.Points.size())));
+				for (uint8 i = 0; i < Obstacle.PointCount; ++i)
+				{
+					Obstacle.Points[i] = ToPixels(Transform, Polygon->m_vertices[i]);
+				}
+				Obstacle.Radius = Physics.MetersToPixels(Polygon->m_radius);
+				break;
+			}
+			case b2Shape::e_edge:
+			{
+				const auto* Edge = static_cast<const b2EdgeShape*>(Shape);
+				AddSegment(Transform, Edge->m_vertex1, Edge->m_vertex2, Edge->m_radius);
+				break;
+			}
+			case b2Shape::e_chain:
+			{
+				const auto* Chain = static_cast<const b2ChainShape*>(Shape);
+				for (int32 i = 0; i + 1 < Chain->m_count; ++i)
+				{
+					AddSegment(Transform, Chain->m_vertices[i], Chain->m_vertices[i + 1], Chain->m_radius);
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		});
+	}
+
+	NavRequestID NavigationSubsystem::FindPath(weak<Object> Owner, vec2f Start, vec2f Goal, PathCallback OnComplete)
+	{
+		const NavRequestID ID = NextRequestID++;
+
+		PathRequest& Request = Requests[ID];
+		Request.Owner = std::move(Owner);
+		Request.OnComplete = std::move(OnComplete);
+		Request.Start = Start;
+		Request.Goal = Goal;
+
+		if (Grid)
+		{
+			Dispatch(ID);
+		}
+		else
+		{
+			WaitingForGrid.push_back(ID);
+		}
+		return ID;
+	}
+
+	void NavigationSubsystem::CancelPath(NavRequestID ID)
+	{
+		// Shared searches keep running; the result just has one listener less
+		Requests.erase(ID);
+	}
+
+	void NavigationSubsystem::Dispatch(NavRequestID ID)
+	{
+		auto It = Requests.find(ID);
+		if (It == Requests.end()) return;
+
+		PathRequest& Request = It->second;
+		const int SnapRadius = WEConfig.Navigation.SnapRadius;
+		const vec2i GoalCell = Grid->WorldToCell(Request.Goal);
+		const auto Start = Grid->FindNearestWalkable(Grid->WorldToCell(Request.Start), SnapRadius);
+		const auto Goal = Grid->FindNearestWalkable(GoalCell, SnapRadius);
+
+		if (!Start || !Goal)
+		{
+			static const auto NoPath = make_shared<const NavPath>();
+			ReadyPaths.emplace_back(ID, NoPath);
+			return;
+		}
+
+		Request.bExactGoal = *Goal == GoalCell;
+
+		// Cached results are still delivered from Tick, so callbacks never run inside FindPath
+		const int64 Key = GetPathKey(*Grid, *Start, *Goal);
+		if (auto Cached = PathCache.find(Key); Cached != PathCache.end())
+		{
+			ReadyPaths.emplace_back(ID, Cached->second);
+			return;
+		}
+
+		auto& Sharing = InFlight[Key];
+		Sharing.push_back(ID);
+		if (Sharing.size() > 1) return;
+
+		GetJobs().Enqueue([Results = Finished, Searched = Grid, Version = GridVersion, SearchEpoch = Epoch, Key, From = *Start, To = *Goal]()
+		{
+			PathResult Result;
+			Result.Key = Key;
+			Result.GridVersion = Version;
+			Result.Epoch = SearchEpoch;
+			Result.Path = make_shared<const NavPath>(SearchPath(*Searched, From, To));
+
+			std::lock_guard Lock{ Results->Mutex };
+			Results->Paths.push_back(std::move(Result));
+		});
+	}
+
+	void NavigationSubsystem::Deliver(NavRequestID ID, const NavPath& Path)
+	{
+		auto It = Requests.find(ID);
+		if (It == Requests.end()) return;
+
+		// Removed first, so the callback may request its next path
+		PathRequest Request = std::move(It->second);
+		Requests.erase(It);
+
+		auto Owner = Request.Owner.lock();
+		if (!Owner || Owner->IsPendingDestroy()) return;
+
+		NavPath Result = Path;
+		if (Result.bFound && Request.bExactGoal && !Result.Points.empty())
+		{
+			Result.Points.back() = Request.Goal;
+		}
+		Request.OnComplete(Result);
+	}
+
+	void NavigationSubsystem::CachePath(int64 Key, shared<const NavPath> Path)
+	{
+		if (PathCache.emplace(Key, std::move(Path)).second)
+		{
+			CacheOrder.push_back(Key);
+		}
+
+		while (CacheOrder.size() > WEConfig.Navigation.MaxCachedPaths)
+		{
+			PathCache.erase(CacheOrder.front());
+			CacheOrder.pop_front();
+		}
+	}
+
+	FlowFieldID NavigationSubsystem::CreateFlowField(vec2f Goal)
+	{
+		const FlowFieldID ID = NextFlowFieldID++;
+
+		FlowFieldState& Field = FlowFields[ID];
+		Field.Buffers = { make_shared<NavFlowField>(), make_shared<NavFlowField>() };
+		Field.Goal = Goal;
+
+		UpdateFlowField(ID, Field);
+		return ID;
+	}
+
+	void NavigationSubsystem::SetFlowFieldGoal(FlowFieldID ID, vec2f Goal)
+	{
+		auto It = FlowFields.find(ID);
+		if (It == FlowFields.end()) return;
+
+		It->second.Goal = Goal;
+		UpdateFlowField(ID, It->second);
+	}
+
+	void NavigationSubsystem::DestroyFlowField(FlowFieldID ID)
+	{
+		// A build in flight keeps its buffer alive and is ignored when it finishes
+		FlowFields.erase(ID);
+	}
+
+	vec2f NavigationSubsystem::GetFlowDirection(FlowFieldID ID, vec2f Position) const
+	{
+		auto It = FlowFields.find(ID);
+		if (It == FlowFields.end()) return {};
+
+		const FlowFieldState& Field = It->second;
+		const NavFlowField& Front = *Field.Buffers[Field.Front];
+		if (!Front.IsValid()) return {};
+
+		// The last cell is crossed straight toward the goal, which may have moved within it
+		if (Front.GetGrid()->WorldToCell(Position) == Front.GetGoalCell())
+		{
+			const vec2f ToGoal = Field.Goal - Position;
+			return LengthSquared(ToGoal) > 1.0f ? Normalize(ToGoal) : vec2f{};
+		}
+		return Front.GetDirection(Position);
+	}
+
+	void NavigationSubsystem::UpdateFlowField(FlowFieldID ID, FlowFieldState& Field)
+	{
+		// Only one build per field runs at a time; the result handler calls back in here
+		if (Field.bBuilding || !Grid) return;
+
+		const vec2i RawCell = Grid->WorldToCell(Field.Goal);
+		const vec2i GoalCell = Grid->FindNearestWalkable(RawCell, WEConfig.Navigation.SnapRadius).value_or(RawCell);
+		if (Field.BuiltGoalCell == GoalCell && Field.BuiltGridVersion == GridVersion) return;
+
+		Field.BuiltGoalCell = GoalCell;
+		Field.BuiltGridVersion = GridVersion;
+		Field.bBuilding = true;
+
+		GetJobs().Enqueue([Results = Finished, Back = Field.Buffers[1 - Field.Front], Built = Grid, ID, GoalCell, BuildEpoch = Epoch]()
+		{
+			Back->Build(Built, GoalCell);
+
+			std::lock_guard Lock{ Results->Mutex };
+			Results->Fields.push_back({ ID, BuildEpoch });
+		});
+	}
+}
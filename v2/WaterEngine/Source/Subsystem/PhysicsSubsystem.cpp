@@ -8,10 +8,12 @@
 #include "Framework/World/World.h"
 #include "Framework/World/Actor.h"
 #include "Component/CollisionComponent.h"
+#include "Component/PhysicsComponent.h"
 #include "box2d/b2_world.h"
 #include "box2d/b2_body.h"
 #include "box2d/b2_math.h"
 #include "box2d/b2_contact.h"
+#include "box2d/b2_fixture.h"
 #include "Utility/Log.h"
 
 namespace we
@@ -60,6 +62,23 @@ namespace we
 
 	static ContactListener s_ContactListener;
 
+	class StaticFixtureQuery : public b2QueryCallback
+	{
+	public:
+		const set<b2Body*>* Excluded = nullptr;
+		vector<const b2Fixture*> Found;
+
+		bool ReportFixture(b2Fixture* Fixture) override
+		{
+			const b2Body* Body = Fixture->GetBody();
+			if (Body->GetType() == b2_staticBody && !Fixture->IsSensor() && !Excluded->contains(Fixture->GetBody()))
+			{
+				Found.push_back(Fixture);
+			}
+			return true;
+		}
+	};
+
 	PhysicsSubsystem::PhysicsSubsystem()
 		: PhysicsWorld{ make_unique<b2World>(b2Vec2{ WEConfig.Physics.Gravity.x, WEConfig.Physics.Gravity.y }) }
 		, PhysicsScale{ WEConfig.Physics.PhysicsScale }
@@ -81,13 +100,43 @@ namespace we
 	void PhysicsSubsystem::Tick(float DeltaTime)
 	{
 		ProcessPendingDestruction();
+		ApplyPendingVelocities();
 		
 		PhysicsWorld->Step(DeltaTime, VelocityIterations, PositionIterations);
 		
 		ProcessPendingDestruction();
+		SyncActorsToBodies();
 		ProcessContactEvents();
 	}
 
+	void PhysicsSubsystem::ApplyPendingVelocities()
+	{
+		for (PhysicsComponent* Component : SyncedBodies)
+		{
+			if (!Component->PendingVelocity) continue;
+
+			const vec2f Velocity = *Component->PendingVelocity;
+			Component->Body->SetLinearVelocity(b2Vec2(PixelsToMeters(Velocity.x), PixelsToMeters(Velocity.y)));
+			Component->PendingVelocity.reset();
+		}
+	}
+
+	void PhysicsSubsystem::SyncActorsToBodies()
+	{
+		for (PhysicsComponent* Component : SyncedBodies)
+		{
+			const b2Body* Body = Component->Body;
+			if (Body->GetType() == b2_staticBody || !Body->IsAwake()) continue;
+
+			// The body sits at the shape offset from the actor
+			const b2Vec2& Pos = Body->GetPosition();
+			Component->Owner->SetPosition({
+				MetersToPixels(Pos.x) - Component->ShapeOffset.x,
+				MetersToPixels(Pos.y) - Component->ShapeOffset.y
+			});
+		}
+	}
+
 	void PhysicsSubsystem::ProcessContactEvents()
 	{
 		if (!CurrentWorld || ContactEventQueue.empty()) return;
@@ -159,6 +208,113 @@ namespace we
 		}
 	}
 
+	void PhysicsSubsystem::RegisterSyncedBody(PhysicsComponent* Component)
+	{
+		if (!Component || Component->SyncIndex != PhysicsComponent::NotSynced) return;
+
+		Component->SyncIndex = SyncedBodies.size();
+		SyncedBodies.push_back(Component);
+	}
+
+	void PhysicsSubsystem::UnregisterSyncedBody(PhysicsComponent* Component)
+	{
+		if (!Component || Component->SyncIndex == PhysicsComponent::NotSynced) return;
+
+		// Swap with the last entry so the list stays dense
+		const ulong Index = Component->SyncIndex;
+		SyncedBodies[Index] = SyncedBodies.back();
+		SyncedBodies[Index]->SyncIndex = Index;
+		SyncedBodies.pop_back();
+		Component->SyncIndex = PhysicsComponent::NotSynced;
+	}
+
+	void PhysicsSubsystem::QueryStaticFixtures(const rectf& Region, const std::function<void(const b2Fixture&)>& Visit) const
+	{
+		b2AABB Box;
+		Box.lowerBound = b2Vec2(PixelsToMeters(Region.position.x), PixelsToMeters(Region.position.y));
+		Box.upperBound = b2Vec2(PixelsToMeters(Region.position.x + Region.size.x), PixelsToMeters(Region.position.y + Region.size.y));
+
+		StaticFixtureQuery Query;
+		Query.Excluded = &PendingDestruction;
+		PhysicsWorld->QueryAABB(&Query, Box);
+
+		// Chain shapes report once per child
+		std::sort(Query.Found.begin(), Query.Found.end());
+		Query.Found.erase(std::unique(Query.Found.begin(), Query.Found.end()), Query.Found.end());
+
+		for (const b2Fixture* Fixture : Query.Found)
+		{
+			Visit(*Fixture);
+		}
+	}
+
+	optional<rectf> PhysicsSubsystem::GetStaticBounds() const
+	{
+		optional<b2AABB> Bounds;
+		for (b2Body* Body = PhysicsWorld->GetBodyList(); Body; Body = Body->GetNext())
+		{
+			if (Body->GetType() != b2_staticBody || PendingDestruction.contains(Body)) continue;
+
+			for (const b2Fixture* Fixture = Body->GetFixtureList(); Fixture; Fixture = Fixture->GetNext())
+			{
+				if (Fixture->IsSensor()) continue;
+
+				for (int32 Child = 0; Child < Fixture->GetShape()->GetChildCount(); ++Child)
+				{
+					const b2AABB& Box = Fixture->GetAABB(Child);
+					if (Bounds) Bounds->Combine(Box);
+					else Bounds = Box;
+				}
+			}
+		}
+
+		if (!Bounds) return std::nullopt;
+
+		const vec2f Low = MetersToPixels(vec2f{ Bounds->lowerBound.x, Bounds->lowerBound.y });
+		const vec2f High = MetersToPixels(vec2f{ Bounds->upperBound.x, Bounds->upperBound.y });
+		return rectf(Low, High - Low);
+	}
+
+	void PhysicsSubsystem::QueueBodyRebuild(PhysicsComponent* Component)
+	{
+		if (Component && std::find(PendingRebuilds.begin(), PendingRebuilds.end(), Component) == PendingRebuilds.end())
+		{
+			PendingRebuilds.push_back(Component);
+		}
+	}
+
+	void PhysicsSubsystem::RebuildQueuedBodies()
+	{
+		if (PendingRebuilds.empty()) return;
+
+		if (bInPhysicsStep)
+		{
+			WARNING("[Physics] Cannot rebuild bodies during a physics step");
+			return;
+		}
+
+		for (auto* Component : PendingRebuilds)
+		{
+			Component->DestroyBody();
+		}
+
+		// Contacts queued against the old bodies would point at freed memory
+		std::erase_if(ContactEventQueue, [this](const ContactEvent& Event)
+		{
+			return PendingDestruction.contains(Event.BodyA) || PendingDestruction.contains(Event.BodyB);
+		});
+		ProcessPendingDestruction();
+
+		for (auto* Component : PendingRebuilds)
+		{
+			Component->CreateBody();
+			Component->SetVelocity(Component->RestoredVelocity);
+		}
+
+		LOG("[Physics] Rebuilt {} bodies", PendingRebuilds.size());
+		PendingRebuilds.clear();
+	}
+
 	void PhysicsSubsystem::RegisterContactListener(b2Body* Body, ActorID ID)
 	{
 		if (Body && ID != INVALID_ACTOR_ID)
@@ -4,19 +4,40 @@
 // =============================================================================
 
 #include "Subsystem/RenderSubsystem.h"
+#include "Render/RenderCapture.h"
 #include "Core/EngineConfig.h"
 #include "Utility/Assert.h"
 #include "Utility/Log.h"
+#include "Utility/Math.h"
+
+#include <cmath>
 
 namespace we
 {
     RenderSubsystem::RenderSubsystem()
         : RenderResolution{WEConfig.Render.RenderResolution}
-        , bNeedsComposite{false}
+        , bNeedsComposite{true}
+        , WorldTargetSize{}
+        , WorldResolutionScale{WEConfig.Render.MaxResolutionScale}
+        , SmoothedFrameTime{0.0f}
+        , Recorder{make_unique<RenderCaptureRecorder>()}
     {
+        // World is cleared to the opaque window color so it can overwrite the composite
+        GetLayer(ERenderLayer::World) = { &WorldRenderTarget, WEConfig.Render.WindowClearColor };
+        GetLayer(ERenderLayer::WorldUI) = { &WorldUIRenderTarget, WEConfig.Render.WorldUIClearColor };
+        GetLayer(ERenderLayer::ScreenUI) = { &ScreenUIRenderTarget, WEConfig.Render.ScreenUIClearColor };
+        GetLayer(ERenderLayer::Cursor) = { &CursorRenderTarget, WEConfig.Render.CursorClearColor };
+
         CreateRenderTargets();
     }
 
+    RenderSubsystem::~RenderSubsystem() = default;
+
+    void RenderSubsystem::RequestCapture(const string& Path, uint FrameCount)
+    {
+        PendingCapture = { Path, FrameCount };
+    }
+
     void RenderSubsystem::SetTargetSize(vec2u Size)
     {
         if (RenderResolution != Size)
@@ -28,7 +49,12 @@ namespace we
 
     void RenderSubsystem::CreateRenderTargets()
     {
-        VERIFY(WorldRenderTarget.resize(RenderResolution));
+        WorldTargetSize = {
+            static_cast<uint>(std::ceil(RenderResolution.x * WEConfig.Render.MaxResolutionScale)),
+            static_cast<uint>(std::ceil(RenderResolution.y * WEConfig.Render.MaxResolutionScale))
+        };
+
+        VERIFY(WorldRenderTarget.resize(WorldTargetSize));
         VERIFY(WorldUIRenderTarget.resize(RenderResolution));
         VERIFY(ScreenUIRenderTarget.resize(RenderResolution));
         VERIFY(CursorRenderTarget.resize(RenderResolution));
@@ -42,9 +68,17 @@ namespace we
 
         if (shader::isAvailable)
         {
-            VERIFY(WorldPostProcessTarget.resize(RenderResolution));
+            VERIFY(WorldPostProcessTarget.resize(WorldTargetSize));
             VERIFY(CompositePostProcessTarget.resize(RenderResolution));
         }
+
+        // Resized targets hold undefined content
+        for (auto& Layer : Layers)
+        {
+            Layer.bHasContent = false;
+            Layer.bInvalidated = true;
+        }
+        bNeedsComposite = true;
     }
 
     void RenderSubsystem::SetWorldView(vec2f Center, float Zoom, float Rotation)
@@ -55,68 +89,210 @@ namespace we
         WorldView.setCenter(Center);
         WorldView.setSize(ViewSize);
         WorldView.setRotation(sf::radians(Rotation));
+
+        // Render into the top-left sub-rect matching the current resolution scale
+        vec2f ScaledSize = vec2f(GetScaledWorldSize());
+        WorldView.setViewport(rectf({0.0f, 0.0f}, {ScaledSize.x / WorldTargetSize.x, ScaledSize.y / WorldTargetSize.y}));
         
         WorldRenderTarget.setView(WorldView);
         if (shader::isAvailable)
         {
             WorldPostProcessTarget.setView(WorldView);
         }
+
+        Recorder->SetWorldView(WorldView);
     }
 
     void RenderSubsystem::BeginFrame()
     {
-        ClearRenderTargets();
-        bNeedsComposite = true;
+        // Layers are cleared lazily on first draw, so untouched layers cost nothing
+        for (auto& Layer : Layers)
+        {
+            Layer.DrawCount = 0;
+            Layer.bDrawnThisFrame = false;
+            Layer.bDisplayed = false;
+        }
+
+
+        if (PendingCapture && !Recorder->IsActive())
+        {
+            Recorder->Start(PendingCapture->first, PendingCapture->second, RenderResolution);
+            PendingCapture.reset();
+        }
+        Recorder->BeginFrame(WorldRenderTarget.getView());
+    }
+
+    void RenderSubsystem::BeginLayer(ERenderLayer Layer)
+    {
+        LayerState& State = GetLayer(Layer);
+        if (State.bDrawnThisFrame) return;
+
+        State.Target->clear(State.ClearColor);
+        State.bDrawnThisFrame = true;
     }
 
     void RenderSubsystem::Draw(const drawable& RenderObject, ERenderLayer Layer)
     {
-        switch (Layer)
+        Draw(RenderObject, Layer, sf::RenderStates::Default);
+    }
+
+    void RenderSubsystem::Draw(const drawable& RenderObject, ERenderLayer Layer, const sf::RenderStates& States)
+    {
+        BeginLayer(Layer);
+
+        LayerState& State = GetLayer(Layer);
+        State.Target->draw(RenderObject, States);
+        ++State.DrawCount;
+
+        if (Recorder->IsActive())
         {
-            case ERenderLayer::World:
-                WorldRenderTarget.draw(RenderObject);
-                break;
-            case ERenderLayer::WorldUI:
-                WorldUIRenderTarget.draw(RenderObject);
-                break;
-            case ERenderLayer::ScreenUI:
-                ScreenUIRenderTarget.draw(RenderObject);
-                break;
-            case ERenderLayer::Cursor:
-                CursorRenderTarget.draw(RenderObject);
-                break;
+            Recorder->Record(RenderObject, Layer, States);
         }
     }
 
+    void RenderSubsystem::EndLayer(ERenderLayer Layer)
+    {
+        // Resolves the layer early, e.g. before another thread samples it
+        LayerState& State = GetLayer(Layer);
+        if (!State.bDrawnThisFrame || State.bDisplayed) return;
+
+        State.Target->display();
+        State.bDisplayed = true;
+    }
+
     void RenderSubsystem::EndFrame()
     {
-        if (bNeedsComposite)
+        ResolveLayers();
+
+        // Time-based composite effects need a fresh composite even when no layer changed.
+        // World effects only run on frames that drew the world, see CompositeLayers
+        if (bNeedsComposite || !CompositePostProcessEffects.empty())
         {
             CompositeLayers();
             bNeedsComposite = false;
         }
+
+        // Measured from one EndFrame to the next, so it covers the whole frame including the
+        // present that waits on the GPU, not just the time spent submitting draws
+        UpdateDynamicResolution(FrameTimer.restart().asSeconds());
+        Recorder->EndFrame();
     }
 
-    sprite RenderSubsystem::GetCompositeSprite() const
+    void RenderSubsystem::UpdateDynamicResolution(float FrameTime)
     {
-        return sprite(Composite.getTexture());
+        if (!WEConfig.Render.bDynamicResolution || PinnedResolutionScale) return;
+
+        // A load or a breakpoint shouldn't drag the scale down for seconds afterwards
+        const float Target = WEConfig.Render.TargetFrameTime;
+        FrameTime = Min(FrameTime, Target * 4.0f);
+
+        SmoothedFrameTime = (SmoothedFrameTime <= 0.0f)
+            ? FrameTime
+            : Lerp(SmoothedFrameTime, FrameTime, WEConfig.Render.FrameTimeSmoothing);
+
+        if (ScaleAdjustTimer.getElapsedTime().asSeconds() < WEConfig.Render.ResolutionAdjustInterval) return;
+
+        // Hysteresis band keeps the scale from oscillating around the target. The upper edge
+        // allows for present jitter; a missed VSync interval pushes the average well past it
+        const bool bOverTarget = SmoothedFrameTime > Target * 1.1f;
+        if (bOverTarget)
+        {
+            OnTargetTimer.restart();
+        }
+        const bool bRecover = WEConfig.Window.bVSyncEnabled
+            && OnTargetTimer.getElapsedTime().asSeconds() >= WEConfig.Render.ResolutionRecoverInterval;
+
+        float NewScale = WorldResolutionScale;
+        if (bOverTarget)
+        {
+            NewScale -= WEConfig.Render.ResolutionScaleStep;
+        }
+        else if (SmoothedFrameTime < Target * 0.75f || bRecover)
+        {
+            NewScale += WEConfig.Render.ResolutionScaleStep;
+            OnTargetTimer.restart();
+        }
+
+        NewScale = Clamp(NewScale, WEConfig.Render.MinResolutionScale, WEConfig.Render.MaxResolutionScale);
+        if (!FloatEquals(NewScale, WorldResolutionScale))
+        {
+            WorldResolutionScale = NewScale;
+            GetLayer(ERenderLayer::World).bInvalidated = true;
+        }
+        ScaleAdjustTimer.restart();
     }
 
-    void RenderSubsystem::ClearRenderTargets()
+    void RenderSubsystem::PinWorldResolutionScale(optional<float> Scale)
     {
-        WorldRenderTarget.clear(WEConfig.Render.WindowClearColor);
-        ScreenUIRenderTarget.clear(WEConfig.Render.ScreenUIClearColor);
-        WorldUIRenderTarget.clear(WEConfig.Render.WorldUIClearColor);
-        CursorRenderTarget.clear(WEConfig.Render.CursorClearColor);
-        Composite.clear(WEConfig.Render.CompositeClearColor);
+        PinnedResolutionScale = Scale;
+        if (!Scale) return;
 
-        if (shader::isAvailable)
+        const float NewScale = Clamp(*Scale, WEConfig.Render.MinResolutionScale, WEConfig.Render.MaxResolutionScale);
+        if (!FloatEquals(NewScale, WorldResolutionScale))
         {
-            WorldPostProcessTarget.clear(color::Transparent);
-            CompositePostProcessTarget.clear(color::Transparent);
+            WorldResolutionScale = NewScale;
+            GetLayer(ERenderLayer::World).bInvalidated = true;
         }
     }
 
+    vec2u RenderSubsystem::GetScaledWorldSize() const
+    {
+        return {
+            Max(1u, static_cast<uint>(RenderResolution.x * WorldResolutionScale)),
+            Max(1u, static_cast<uint>(RenderResolution.y * WorldResolutionScale))
+        };
+    }
+
+    void RenderSubsystem::SetLayerRetained(ERenderLayer Layer, bool bRetained)
+    {
+        LayerState& State = GetLayer(Layer);
+        State.bRetained = bRetained;
+        State.bInvalidated = true;
+    }
+
+    void RenderSubsystem::InvalidateLayer(ERenderLayer Layer)
+    {
+        GetLayer(Layer).bInvalidated = true;
+    }
+
+    bool RenderSubsystem::NeedsRedraw(ERenderLayer Layer) const
+    {
+        const LayerState& State = GetLayer(Layer);
+        return !State.bRetained || State.bInvalidated;
+    }
+
+    uint RenderSubsystem::GetLayerDrawCount(ERenderLayer Layer) const
+    {
+        return GetLayer(Layer).DrawCount;
+    }
+
+    void RenderSubsystem::ResolveLayers()
+    {
+        for (auto& Layer : Layers)
+        {
+            if (Layer.bDrawnThisFrame)
+            {
+                Layer.bHasContent = true;
+                Layer.bInvalidated = false;
+                bNeedsComposite = true;
+            }
+            else if (Layer.bHasContent && (!Layer.bRetained || Layer.bInvalidated))
+            {
+                // Layer emptied since last frame, or a retained layer invalidated with nothing
+                // left to draw: clear once, then skip until drawn again
+                Layer.Target->clear(Layer.ClearColor);
+                Layer.Target->display();
+                Layer.bHasContent = false;
+                bNeedsComposite = true;
+            }
+        }
+    }
+
+    sprite RenderSubsystem::GetCompositeSprite() const
+    {
+        return sprite(Composite.getTexture());
+    }
+
     void RenderSubsystem::PostProcess(renderTexture* Input, renderTexture* Output, vector<unique<IPostProcess>>& Effects)
     {
         if (Effects.empty())
@@ -162,23 +338,44 @@ namespace we
 
     void RenderSubsystem::CompositeLayers()
     {
-        ApplyPostProcess(WorldRenderTarget, WorldPostProcessTarget, WorldPostProcessEffects);
-
-        WorldUIRenderTarget.display();
-        ScreenUIRenderTarget.display();
-        CursorRenderTarget.display();
+        // Effects write back into the world target, so a frame that did not redraw the
+        // world reuses the processed result instead of processing it a second time
+        const LayerState& World = GetLayer(ERenderLayer::World);
+        if (World.bDrawnThisFrame)
+        {
+            ApplyPostProcess(WorldRenderTarget, WorldPostProcessTarget, WorldPostProcessEffects);
+        }
 
-        sprite WorldSprite(WorldRenderTarget.getTexture());
-        Composite.draw(WorldSprite);
+        // The opaque world layer replaces every composite pixel, so no clear is needed
+        if (World.bHasContent)
+        {
+            // Upscale the rendered sub-rect back to native resolution
+            vec2u ScaledSize = GetScaledWorldSize();
+            sprite WorldSprite(WorldRenderTarget.getTexture(), recti({0, 0}, vec2i(ScaledSize)));
+            WorldSprite.setScale({
+                static_cast<float>(RenderResolution.x) / ScaledSize.x,
+                static_cast<float>(RenderResolution.y) / ScaledSize.y
+            });
+            Composite.draw(WorldSprite, sf::BlendNone);
+        }
+        else
+        {
+            Composite.clear(WEConfig.Render.CompositeClearColor);
+        }
 
-        sprite WorldUISprite(WorldUIRenderTarget.getTexture());
-        Composite.draw(WorldUISprite, sf::BlendAlpha);
+        for (auto Layer : { ERenderLayer::WorldUI, ERenderLayer::ScreenUI, ERenderLayer::Cursor })
+        {
+            const LayerState& State = GetLayer(Layer);
+            if (!State.bHasContent) continue;
 
-        sprite ScreenUISprite(ScreenUIRenderTarget.getTexture());
-        Composite.draw(ScreenUISprite, sf::BlendAlpha);
+            if (State.bDrawnThisFrame && !State.bDisplayed)
+            {
+                State.Target->display();
+            }
 
-        sprite CursorSprite(CursorRenderTarget.getTexture());
-        Composite.draw(CursorSprite, sf::BlendAlpha);
+            sprite LayerSprite(State.Target->getTexture());
+            Composite.draw(LayerSprite, sf::BlendAlpha);
+        }
 
         ApplyPostProcess(Composite, CompositePostProcessTarget, CompositePostProcessEffects);
     }
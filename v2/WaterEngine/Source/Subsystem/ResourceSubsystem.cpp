@@ -4,14 +4,30 @@
 // =============================================================================
 
 #include "Subsystem/ResourceSubsystem.h"
+#include "Core/EngineConfig.h"
+#include "Utility/JobSystem.h"
+#include "Utility/Math.h"
 #include "Utility/Log.h"
 
 #ifdef USE_PACKED_ASSETS
+#include "Utility/PackFileStream.h"
 #include <physfs.h>
 #endif
 
 namespace we
 {
+    #ifdef USE_PACKED_ASSETS
+    namespace
+    {
+        // Member order matters: the music stops streaming before its stream closes
+        struct StreamedMusic
+        {
+            PackFileStream Stream;
+            music Music;
+        };
+    }
+    #endif
+
     ResourceSubsystem* ResourceSubsystem::Instance = nullptr;
 
     ResourceSubsystem::ResourceSubsystem()
@@ -40,6 +56,8 @@ namespace we
     ResourceSubsystem::~ResourceSubsystem()
     {
         #ifdef USE_PACKED_ASSETS
+            // Streamed music still holds open pack files
+            Music.clear();
             PHYSFS_deinit();
         #endif
     }
@@ -109,33 +127,183 @@ namespace we
         return Tex;
     }
 
+    shared<image> ResourceSubsystem::DecodeImage(const string& Filename)
+    {
+        auto Decoded = make_shared<image>();
+
+        #ifdef USE_RAW_ASSETS
+            if (!Decoded->loadFromFile(ResolvePath(Filename)))
+                return nullptr;
+        #else
+            string FileData = LoadFileData(ResolvePath(Filename));
+            if (FileData.empty() || !Decoded->loadFromMemory(FileData.data(), FileData.size()))
+                return nullptr;
+        #endif
+
+        return Decoded;
+    }
+
+    shared<texture> ResourceSubsystem::LoadTexture(const string& Filename, const image& Decoded)
+    {
+        if (Textures.contains(Filename))
+            return Textures[Filename];
+
+        auto Tex = make_shared<texture>();
+        if (!Tex->loadFromImage(Decoded))
+        {
+            ERROR("ResourceSubsystem: Failed to upload texture {}", Filename);
+            return nullptr;
+        }
+
+        Textures[Filename] = Tex;
+        return Tex;
+    }
+
+    string ResourceSubsystem::FindTextureName(const texture* Texture) const
+    {
+        for (const auto& [Name, Cached] : Textures)
+        {
+            if (Cached.get() == Texture) return Name;
+        }
+        return {};
+    }
+
     shared<soundBuffer> ResourceSubsystem::LoadSound(const string& Filename)
     {
         if (Sounds.contains(Filename))
             return Sounds[Filename];
 
-        string Path = ResolvePath(Filename);
-        auto Snd = make_shared<soundBuffer>();
-        
-        #ifdef USE_RAW_ASSETS
-            if (!Snd->loadFromFile(Path))
+        auto Snd = DecodeSound(ResolvePath(Filename), false);
+        if (!Snd)
+        {
+            ERROR("ResourceSubsystem: Failed to load sound {}", Filename);
+            return nullptr;
+        }
+
+        Sounds[Filename] = Snd;
+        return Snd;
+    }
+
+    vector<shared<soundBuffer>> ResourceSubsystem::PreloadSounds(const vector<string>& Filenames, bool bCompact)
+    {
+        clock Timer;
+        vector<string> Missing;
+        for (const auto& Filename : Filenames)
+        {
+            if (!Sounds.contains(Filename) && std::find(Missing.begin(), Missing.end(), Filename) == Missing.end())
             {
-                ERROR("ResourceSubsystem: Failed to load sound {}", Filename);
-                return nullptr;
+                Missing.push_back(Filename);
             }
-        #else
-            string FileData = LoadFileData(Path);
-            if (FileData.empty() || !Snd->loadFromMemory(
-                reinterpret_cast<const uint8_t*>(FileData.data()), FileData.size()))
+        }
+
+        // Workers only decode; the cache is filled back on this thread
+        vector<string> Paths;
+        Paths.reserve(Missing.size());
+        for (const auto& Filename : Missing)
+        {
+            Paths.push_back(ResolvePath(Filename));
+        }
+
+        vector<shared<soundBuffer>> Decoded(Missing.size());
+        GetJobs().ParallelFor(Paths.size(), 1, [&](ulong Begin, ulong End)
+        {
+            for (ulong i = Begin; i < End; ++i)
             {
-                ERROR("ResourceSubsystem: Failed to load sound {}", Filename);
-                return nullptr;
+                Decoded[i] = DecodeSound(Paths[i], bCompact);
             }
-            Data[Filename] = std::move(FileData);
+        });
+
+        ulong DecodedBytes = 0;
+        for (ulong i = 0; i < Missing.size(); ++i)
+        {
+            if (!Decoded[i])
+            {
+                ERROR("ResourceSubsystem: Failed to load sound {}", Missing[i]);
+                continue;
+            }
+            DecodedBytes += GetSoundMemory(*Decoded[i]);
+            Sounds[Missing[i]] = std::move(Decoded[i]);
+        }
+
+        if (!Missing.empty())
+        {
+            LOG("ResourceSubsystem: Decoded {} sounds ({} KB) on {} job workers in {:.1f} ms, {} KB of sounds cached",
+                Missing.size(), DecodedBytes / 1024, GetJobs().GetWorkerCount(),
+                Timer.getElapsedTime().asSeconds() * 1000.0f, GetSoundMemoryUsage() / 1024);
+        }
+
+        vector<shared<soundBuffer>> Result;
+        Result.reserve(Filenames.size());
+        for (const auto& Filename : Filenames)
+        {
+            auto It = Sounds.find(Filename);
+            if (It != Sounds.end())
+            {
+                Result.push_back(It->second);
+            }
+        }
+        return Result;
+    }
+
+    ulong ResourceSubsystem::GetSoundMemoryUsage() const
+    {
+        ulong Bytes = 0;
+        for (const auto& [Name, Buffer] : Sounds)
+        {
+            Bytes += GetSoundMemory(*Buffer);
+        }
+        return Bytes;
+    }
+
+    ulong ResourceSubsystem::GetSoundMemory(const soundBuffer& Buffer)
+    {
+        return static_cast<ulong>(Buffer.getSampleCount()) * sizeof(std::int16_t);
+    }
+
+    shared<soundBuffer> ResourceSubsystem::DecodeSound(const string& Path, bool bCompact)
+    {
+        #ifdef USE_RAW_ASSETS
+            sf::InputSoundFile File;
+            if (!File.openFromFile(Path))
+                return nullptr;
+        #else
+            // The stream must outlive the file reading from it
+            PackFileStream Stream;
+            sf::InputSoundFile File;
+            if (!Stream.Open(Path) || !File.openFromStream(Stream))
+                return nullptr;
         #endif
 
-        Sounds[Filename] = Snd;
-        return Snd;
+        const uint ChannelCount = File.getChannelCount();
+        vector<std::int16_t> Samples(static_cast<ulong>(File.getSampleCount()));
+        Samples.resize(static_cast<ulong>(File.read(Samples.data(), Samples.size())));
+        vector<sf::SoundChannel> ChannelMap = File.getChannelMap();
+
+        // Short stereo effects gain little from the second channel, average it away
+        if (bCompact && ChannelCount > 1 && File.getDuration().asSeconds() <= WEConfig.Audio.CompactSoundMaxDuration)
+        {
+            const ulong FrameCount = Samples.size() / ChannelCount;
+            for (ulong Frame = 0; Frame < FrameCount; ++Frame)
+            {
+                int Sum = 0;
+                for (uint Channel = 0; Channel < ChannelCount; ++Channel)
+                {
+                    Sum += Samples[Frame * ChannelCount + Channel];
+                }
+                Samples[Frame] = static_cast<std::int16_t>(Sum / static_cast<int>(ChannelCount));
+            }
+            Samples.resize(FrameCount);
+            Samples.shrink_to_fit();
+            ChannelMap = { sf::SoundChannel::Mono };
+        }
+
+        auto Buffer = make_shared<soundBuffer>();
+        if (!Buffer->loadFromSamples(Samples.data(), Samples.size(),
+            static_cast<uint>(ChannelMap.size()), File.getSampleRate(), ChannelMap))
+        {
+            return nullptr;
+        }
+        return Buffer;
     }
 
     shared<font> ResourceSubsystem::LoadFont(const string& Filename)
@@ -169,27 +337,32 @@ namespace we
 
     shared<music> ResourceSubsystem::LoadMusic(const string& Filename)
     {
-        if (Music.contains(Filename))
-            return Music[Filename];
+        if (auto It = Music.find(Filename); It != Music.end())
+        {
+            if (auto Cached = It->second.lock())
+                return Cached;
+        }
 
         string Path = ResolvePath(Filename);
-        auto Mus = make_shared<music>();
+        shared<music> Mus;
         
         #ifdef USE_RAW_ASSETS
+            Mus = make_shared<music>();
             if (!Mus->openFromFile(Path))
             {
                 ERROR("ResourceSubsystem: Failed to load music {}", Filename);
                 return nullptr;
             }
         #else
-            string FileData = LoadFileData(Path);
-            if (FileData.empty() || !Mus->openFromMemory(
-                reinterpret_cast<const uint8_t*>(FileData.data()), FileData.size()))
+            // Streams chunk by chunk from the pack instead of keeping the whole file resident
+            auto Streamed = make_shared<StreamedMusic>();
+            if (!Streamed->Stream.Open(Path) || !Streamed->Music.openFromStream(Streamed->Stream))
             {
                 ERROR("ResourceSubsystem: Failed to load music {}", Filename);
                 return nullptr;
             }
-            Data[Filename] = std::move(FileData);
+            // Shares ownership with the stream, which is released with the last reference
+            Mus = shared<music>(Streamed, &Streamed->Music);
         #endif
 
         Music[Filename] = Mus;
@@ -222,6 +395,6 @@ namespace we
         CleanCache(Textures, "texture");
         CleanCache(Sounds, "sound");
         CleanCache(Fonts, "font");
-        CleanCache(Music, "music");
+        std::erase_if(Music, [](const auto& Entry) { return Entry.second.expired(); });
     }
 }
\ No newline at end of file
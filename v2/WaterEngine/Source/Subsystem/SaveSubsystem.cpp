@@ -4,12 +4,17 @@
 // =============================================================================
 
 #include "Subsystem/SaveSubsystem.h"
+#include "Core/EngineConfig.h"
 #include "Utility/Log.h"
 
+#include <cstdio>
+#include <filesystem>
+
 #ifdef _WIN32
 #include <shlobj.h>
 #include <windows.h>
 #else
+#include <fcntl.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <pwd.h>
@@ -17,68 +22,201 @@
 
 namespace we
 {
+	namespace
+	{
+		bool ReadFileBytes(const string& Path, vector<uint8>& OutBytes)
+		{
+			std::ifstream File(Path, std::ios::binary);
+			if (!File) return false;
+
+			OutBytes.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+			return true;
+		}
+	}
+
 	SaveSubsystem::SaveSubsystem()
 	{
 		SavePath = GetSavePath();
+		SaveData = json::object();
 
-		if (filestream File{ SavePath })
+		vector<uint8> Bytes;
+		string LegacyPath = (std::filesystem::path(SavePath).parent_path() / WEConfig.Save.LegacySaveFileName).string();
+		if (ReadFileBytes(SavePath, Bytes) || ReadFileBytes(LegacyPath, Bytes))
 		{
-			try { SaveData = json::parse(File); }
-			catch (...) { SaveData = json::object(); }
-		}
-		else
-		{
-			SaveData = json::object();
+			json Loaded = Decode(Bytes);
+			if (Loaded.is_object())
+			{
+				SaveData = std::move(Loaded);
+			}
+			else
+			{
+				ERROR("Save file is unreadable, starting fresh: {}", SavePath);
+			}
 		}
+
+		Writer = std::thread(&SaveSubsystem::RunWriter, this);
 	}
 
 	SaveSubsystem::~SaveSubsystem()
 	{
 		Save();
+		{
+			std::lock_guard Lock{Mutex};
+			bStopRequested = true;
+		}
+		Condition.notify_all();
+		Writer.join();
 	}
 
 	string SaveSubsystem::GetSavePath() const
 	{
+		std::filesystem::path Directory;
 #ifdef _WIN32
-		// Windows: %APPDATA%/WaterEngine/Save.json
+		// Windows: %APPDATA%/WaterEngine/Save.dat
 		char Path[MAX_PATH];
 		if (SUCCEEDED(SHGetFolderPathA(nullptr, CSIDL_APPDATA, nullptr, 0, Path)))
 		{
-			string Result = Path;
-			Result += "\\WaterEngine";
-			CreateDirectoryA(Result.c_str(), nullptr); // Ensure dir exists
-			return Result + "\\Save.json";
+			Directory = std::filesystem::path(Path) / WEConfig.Save.GameName;
 		}
-		return "Save.json"; // Fallback
 #else
-		// Linux/macOS: ~/.config/WaterEngine/Save.json
+		// Linux/macOS: ~/.config/WaterEngine/Save.dat
 		const char* Home = getenv("HOME");
 		if (!Home)
 		{
 			struct passwd* Pw = getpwuid(getuid());
 			Home = Pw ? Pw->pw_dir : ".";
 		}
-		string Result = Home;
-		Result += "/.config/WaterEngine";
+		Directory = std::filesystem::path(Home) / ".config" / WEConfig.Save.GameName;
+#endif
 
-		// Create directory if needed
-		string Cmd = "mkdir -p " + Result;
-		system(Cmd.c_str());
+		std::error_code Error;
+		if (!Directory.empty() && !std::filesystem::create_directories(Directory, Error) && Error)
+		{
+			ERROR("Failed to create save directory {}: {}", Directory.string(), Error.message());
+			Directory.clear();
+		}
 
-		return Result + "/Save.json";
-#endif
+		// Fallback next to the executable
+		return (Directory / WEConfig.Save.SaveFileName).string();
 	}
 
 	void SaveSubsystem::Save()
 	{
-		if (outstream File{ SavePath })
+		// Copying the tree is the only part that stays on the game thread
+		json Snapshot = SaveData;
 		{
-			File << SaveData.dump(4);
+			std::lock_guard Lock{Mutex};
+			PendingSnapshot = std::move(Snapshot);
+		}
+		Condition.notify_all();
+	}
+
+	void SaveSubsystem::Flush()
+	{
+		std::unique_lock Lock{Mutex};
+		Condition.wait(Lock, [this] { return !PendingSnapshot && !bWriting; });
+	}
+
+	void SaveSubsystem::RunWriter()
+	{
+		std::unique_lock Lock{Mutex};
+		while (true)
+		{
+			Condition.wait(Lock, [this] { return PendingSnapshot || bStopRequested; });
+			if (!PendingSnapshot)
+				return;
+
+			json Snapshot = std::move(*PendingSnapshot);
+			PendingSnapshot.reset();
+			bWriting = true;
+			Lock.unlock();
+
+			if (!WriteFileAtomic(SavePath, Encode(Snapshot)))
+			{
+				ERROR("Failed to write save to: {}", SavePath);
+			}
+
+			Lock.lock();
+			bWriting = false;
+			Condition.notify_all();
 		}
-		else
+	}
+
+	vector<uint8> SaveSubsystem::Encode(const json& Data)
+	{
+		switch (WEConfig.Save.SaveFormat)
+		{
+		case ESaveFormat::MessagePack:
+			return json::to_msgpack(Data);
+		case ESaveFormat::Cbor:
+			return json::to_cbor(Data);
+		default:
+		{
+			string Text = Data.dump(4);
+			return vector<uint8>(Text.begin(), Text.end());
+		}
+		}
+	}
+
+	json SaveSubsystem::Decode(const vector<uint8>& Bytes)
+	{
+		if (Bytes.empty())
+			return json();
+
+		// The root is always an object: '{' in JSON, a fixmap/map16/map32 in MessagePack,
+		// a major type 5 map in CBOR
+		const uint8 First = Bytes.front();
+		const bool bMessagePack = (First >= 0x80 && First <= 0x8F) || First == 0xDE || First == 0xDF;
+		const bool bCbor = First >= 0xA0 && First <= 0xBF;
+
+		if (bMessagePack)
+			return json::from_msgpack(Bytes, true, false);
+		if (bCbor)
+			return json::from_cbor(Bytes, true, false);
+		return json::parse(Bytes, nullptr, false);
+	}
+
+	bool SaveSubsystem::WriteFileAtomic(const string& Path, const vector<uint8>& Bytes)
+	{
+		const string TempPath = Path + ".tmp";
+
+#ifdef _WIN32
+		HANDLE File = CreateFileA(TempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+			return false;
+
+		DWORD Written = 0;
+		bool bSuccess = WriteFile(File, Bytes.data(), static_cast<DWORD>(Bytes.size()), &Written, nullptr)
+			&& Written == Bytes.size()
+			&& FlushFileBuffers(File);
+		CloseHandle(File);
+
+		bSuccess = bSuccess && MoveFileExA(TempPath.c_str(), Path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+		int File = open(TempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (File < 0)
+			return false;
+
+		ulong Offset = 0;
+		while (Offset < Bytes.size())
+		{
+			ssize_t Written = write(File, Bytes.data() + Offset, Bytes.size() - Offset);
+			if (Written <= 0) break;
+			Offset += static_cast<ulong>(Written);
+		}
+		bool bSuccess = Offset == Bytes.size() && fsync(File) == 0;
+		bSuccess = close(File) == 0 && bSuccess;
+
+		// rename replaces the old save in one step, a crash leaves either the old or the new file
+		bSuccess = bSuccess && std::rename(TempPath.c_str(), Path.c_str()) == 0;
+#endif
+
+		if (!bSuccess)
 		{
-			ERROR("Failed to write save to: {}", SavePath);
+			std::error_code Error;
+			std::filesystem::remove(TempPath, Error);
 		}
+		return bSuccess;
 	}
 
 	bool SaveSubsystem::Has(stringView Key) const
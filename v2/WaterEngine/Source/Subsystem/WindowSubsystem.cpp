@@ -36,6 +36,12 @@ namespace we
 		Event.visit(Handler);
 	}
 
+	void WindowSubsystem::CloseWindow()
+	{
+		OnBeforeClose.Broadcast();
+		close();
+	}
+
 	void WindowSubsystem::ToggleFullscreen()
 	{
 		SetFullscreen(!bFullscreen);
@@ -53,7 +59,7 @@ namespace we
 		}
 
 		bFullscreen = bEnabled;
-		close();
+		CloseWindow();
 
 		if (bFullscreen)
 		{
@@ -77,6 +83,7 @@ namespace we
 		setKeyRepeatEnabled(WEConfig.Window.bKeyRepeatEnabled);
 		SetIcon(WEConfig.Window.WindowIcon);
 
+		OnRecreated.Broadcast();
 		OnResize.Broadcast(getSize());
 	}
 
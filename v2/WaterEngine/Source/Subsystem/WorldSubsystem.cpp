@@ -6,12 +6,27 @@
 #include "Subsystem/WorldSubsystem.h"
 #include "Framework/World/World.h"
 #include "Subsystem/PhysicsSubsystem.h"
+#include "Subsystem/NavigationSubsystem.h"
 #include "Subsystem/CameraSubsystem.h"
 #include "Subsystem/SaveSubsystem.h"
 #include "Framework/GameInstance.h"
+#include "Render/StaticLayerCache.h"
+#include "Core/EngineConfig.h"
+
+#include <cmath>
 
 namespace we
 {
+    WorldSubsystem::WorldSubsystem()
+    {
+        if (WEConfig.Render.bStaticLayerCache)
+        {
+            StaticCache = make_unique<StaticLayerCache>();
+        }
+    }
+
+    WorldSubsystem::~WorldSubsystem() = default;
+
     void WorldSubsystem::SetPhysicsRef(shared<PhysicsSubsystem> InPhysics)
     {
         Physics = InPhysics;
@@ -27,6 +42,16 @@ namespace we
         return *Physics.lock();
     }
 
+    void WorldSubsystem::SetNavigationRef(shared<NavigationSubsystem> InNavigation)
+    {
+        Navigation = InNavigation;
+    }
+
+    NavigationSubsystem& WorldSubsystem::GetNavigation()
+    {
+        return *Navigation.lock();
+    }
+
     CameraSubsystem& WorldSubsystem::GetCamera()
     {
         return *Camera.lock();
@@ -63,6 +88,11 @@ namespace we
 
             CurrentWorld = PendingWorld;
             PendingWorld = nullptr;
+
+            if (StaticCache)
+            {
+                StaticCache->Clear();
+            }
             
             // Update physics subsystem's current world for contact callbacks
             if (auto PhysicsPtr = Physics.lock())
@@ -96,7 +126,7 @@ namespace we
         }
     }
 
-    vector<const drawable*>& WorldSubsystem::GetOrderedDrawables() const
+    vector<const drawable*>& WorldSubsystem::GetOrderedDrawables(vector<float>* OutDepths) const
     {
         static vector<const drawable*> Drawables;
         static vector<pair<uint, float>> Indices;
@@ -113,10 +143,28 @@ namespace we
         const auto& Actors = CurrentWorld->GetActors();
         Drawables.reserve(Actors.size() * 2);
         Indices.reserve(Actors.size() * 2);
+
+        if (StaticCache)
+        {
+            static vector<pair<const drawable*, float>> StaticDrawables;
+            StaticDrawables.clear();
+
+            StaticCache->Update(*CurrentWorld);
+            StaticCache->CollectVisible(GetCameraCullBounds(), StaticDrawables);
+
+            for (const auto& [Drawable, Depth] : StaticDrawables)
+            {
+                Indices.emplace_back(Drawables.size(), Depth);
+                Drawables.push_back(Drawable);
+            }
+        }
         
         for (uint i = 0; i < Actors.size(); ++i)
         {
             const auto& Actor = Actors[i];
+            if (StaticCache && Actor->IsStatic())
+                continue;
+
             if (!Actor->IsPendingDestroy() && Actor->IsVisible())
             {
                 ActorDrawables.clear();
@@ -149,8 +197,48 @@ namespace we
         {
             SortedDrawables.push_back(Drawables[Index]);
         }
+
+        if (OutDepths)
+        {
+            OutDepths->clear();
+            OutDepths->reserve(Indices.size());
+            for (const auto& [Index, Depth] : Indices)
+            {
+                OutDepths->push_back(Depth);
+            }
+        }
         
         Drawables = std::move(SortedDrawables);
         return Drawables;
     }
+
+    rectf WorldSubsystem::GetCameraCullBounds() const
+    {
+        auto CameraPtr = Camera.lock();
+        if (!CameraPtr)
+            return rectf({-1e9f, -1e9f}, {2e9f, 2e9f});
+
+        // Square around the view diagonal so rotation never culls visible tiles
+        vec2f ViewSize = vec2f(WEConfig.Render.RenderResolution) / CameraPtr->GetViewZoom();
+        float Extent = std::sqrt(ViewSize.x * ViewSize.x + ViewSize.y * ViewSize.y);
+        vec2f Center = CameraPtr->GetViewPosition();
+        return rectf(Center - vec2f{Extent, Extent} / 2.0f, {Extent, Extent});
+    }
+
+    void WorldSubsystem::CollectSpriteTextures(vector<shared<texture>>& OutTextures) const
+    {
+        if (!CurrentWorld)
+            return;
+
+        // Many actors share a texture; only the first reference is copied
+        CollectedTextures.clear();
+        for (const auto& Actor : CurrentWorld->GetActors())
+        {
+            const auto& Texture = Actor->GetSpriteTexture();
+            if (Texture && CollectedTextures.insert(Texture.get()).second)
+            {
+                OutTextures.push_back(Texture);
+            }
+        }
+    }
 }
@@ -0,0 +1,131 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Utility/JobSystem.h"
+#include "Core/EngineConfig.h"
+#include "Utility/Math.h"
+
+#include <atomic>
+
+namespace we
+{
+    namespace
+    {
+        // Helpers queued for a ParallelFor may start after it returned; they only touch
+        // this shared state then, and find no chunk left to run
+        struct ParallelBatch
+        {
+            const std::function<void(ulong, ulong)>* Body = nullptr;
+            ulong Count = 0;
+            ulong ChunkSize = 1;
+            ulong ChunkCount = 0;
+            std::atomic<ulong> NextChunk{0};
+            std::atomic<ulong> DoneChunks{0};
+
+            void Run()
+            {
+                for (ulong Chunk = NextChunk++; Chunk < ChunkCount; Chunk = NextChunk++)
+                {
+                    const ulong Begin = Chunk * ChunkSize;
+                    (*Body)(Begin, Min(Count, Begin + ChunkSize));
+
+                    if (++DoneChunks == ChunkCount)
+                    {
+                        DoneChunks.notify_all();
+                    }
+                }
+            }
+        };
+    }
+
+    JobSystem& JobSystem::Get()
+    {
+        static JobSystem Instance;
+        return Instance;
+    }
+
+    JobSystem::JobSystem()
+    {
+        const uint Hardware = Max(2u, std::thread::hardware_concurrency());
+        const uint ThreadCount = WEConfig.Jobs.WorkerThreads > 0 ? WEConfig.Jobs.WorkerThreads : Hardware - 1;
+        for (uint i = 0; i < ThreadCount; ++i)
+        {
+            Workers.emplace_back(&JobSystem::RunWorker, this);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard Lock{Mutex};
+            bStopRequested = true;
+            Jobs.clear();
+        }
+        Condition.notify_all();
+
+        for (auto& Worker : Workers)
+        {
+            Worker.join();
+        }
+    }
+
+    void JobSystem::Enqueue(std::function<void()> Job)
+    {
+        {
+            std::lock_guard Lock{Mutex};
+            Jobs.push_back(std::move(Job));
+        }
+        Condition.notify_one();
+    }
+
+    void JobSystem::ParallelFor(ulong Count, ulong ChunkSize, const std::function<void(ulong, ulong)>& Body)
+    {
+        if (Count == 0) return;
+
+        auto Batch = make_shared<ParallelBatch>();
+        Batch->Body = &Body;
+        Batch->Count = Count;
+        Batch->ChunkSize = Max<ulong>(1, ChunkSize);
+        Batch->ChunkCount = (Count + Batch->ChunkSize - 1) / Batch->ChunkSize;
+
+        const ulong HelperCount = Min<ulong>(Workers.size(), Batch->ChunkCount - 1);
+        if (HelperCount > 0)
+        {
+            {
+                std::lock_guard Lock{Mutex};
+                for (ulong i = 0; i < HelperCount; ++i)
+                {
+                    Jobs.push_back([Batch]() { Batch->Run(); });
+                }
+            }
+            Condition.notify_all();
+        }
+
+        Batch->Run();
+
+        // Chunks claimed by workers may still be running
+        for (ulong Done = Batch->DoneChunks.load(); Done < Batch->ChunkCount; Done = Batch->DoneChunks.load())
+        {
+            Batch->DoneChunks.wait(Done);
+        }
+    }
+
+    void JobSystem::RunWorker()
+    {
+        while (true)
+        {
+            std::function<void()> Job;
+            {
+                std::unique_lock Lock{Mutex};
+                Condition.wait(Lock, [this]() { return bStopRequested || !Jobs.empty(); });
+                if (bStopRequested) return;
+
+                Job = std::move(Jobs.front());
+                Jobs.pop_front();
+            }
+            Job();
+        }
+    }
+}
@@ -0,0 +1,83 @@
+// =============================================================================
+// Water Engine v2.1.2
+// Copyright(C) 2026 Will The Water
+// =============================================================================
+
+#include "Utility/PackFileStream.h"
+
+#ifdef USE_PACKED_ASSETS
+
+#include "Core/EngineConfig.h"
+#include "Utility/Log.h"
+
+namespace we
+{
+    PackFileStream::~PackFileStream()
+    {
+        Close();
+    }
+
+    bool PackFileStream::Open(const string& Path)
+    {
+        Close();
+
+        File = PHYSFS_openRead(Path.c_str());
+        if (!File)
+        {
+            ERROR("PackFileStream: Failed to open {}", Path);
+            return false;
+        }
+
+        // Decoders issue many small reads; batch them into larger pack reads
+        if (!PHYSFS_setBuffer(File, WEConfig.Resource.StreamBufferSize))
+        {
+            WARNING("PackFileStream: Failed to set read buffer for {}", Path);
+        }
+        return true;
+    }
+
+    void PackFileStream::Close()
+    {
+        if (File)
+        {
+            PHYSFS_close(File);
+            File = nullptr;
+        }
+    }
+
+    optional<std::size_t> PackFileStream::read(void* Data, std::size_t Size)
+    {
+        if (!File) return std::nullopt;
+
+        PHYSFS_sint64 Read = PHYSFS_readBytes(File, Data, static_cast<PHYSFS_uint64>(Size));
+        if (Read < 0) return std::nullopt;
+        return static_cast<std::size_t>(Read);
+    }
+
+    optional<std::size_t> PackFileStream::seek(std::size_t Position)
+    {
+        if (!File || !PHYSFS_seek(File, static_cast<PHYSFS_uint64>(Position)))
+            return std::nullopt;
+        return Position;
+    }
+
+    optional<std::size_t> PackFileStream::tell()
+    {
+        if (!File) return std::nullopt;
+
+        PHYSFS_sint64 Position = PHYSFS_tell(File);
+        if (Position < 0) return std::nullopt;
+        return static_cast<std::size_t>(Position);
+    }
+
+    optional<std::size_t> PackFileStream::getSize()
+    {
+        if (!File) return std::nullopt;
+
+        PHYSFS_sint64 Length = PHYSFS_fileLength(File);
+        if (Length < 0) return std::nullopt;
+        return static_cast<std::size_t>(Length);
+    }
+}
+
+#endif // USE_PACKED_ASSETS